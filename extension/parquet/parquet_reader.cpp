@@ -19,6 +19,7 @@
 #include "templated_column_reader.hpp"
 #include "thrift_tools.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/profiling_info.hpp"
 
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/encryption_state.hpp"
@@ -26,8 +27,11 @@
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -752,6 +756,10 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 			if (skip_chunk) {
 				// this effectively will skip this chunk
 				state.group_offset = group.num_rows;
+				auto metrics = OperatorMetrics::Active();
+				if (metrics) {
+					metrics->row_groups_skipped++;
+				}
 				return;
 			}
 		}
@@ -837,6 +845,25 @@ void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
 	}
 }
 
+void FilterBloom(Vector &v, const BloomFilter &bloom_filter, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	// only look at the rows that are still selected - the values of other rows might not have been read
+	SelectionVector sel(count);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask.test(i)) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	sel_count = bloom_filter.Filter(v, count, sel, sel_count);
+	filter_mask.reset();
+	for (idx_t i = 0; i < sel_count; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 template <class T, class OP>
 void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
 	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
@@ -979,6 +1006,31 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::BLOOM_FILTER:
+		FilterBloom(v, filter.Cast<BloomFilter>(), filter_mask, count);
+		break;
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		parquet_filter_t in_mask;
+		for (auto &value : in_filter.values) {
+			parquet_filter_t child_mask = filter_mask;
+			FilterOperationSwitch<Equals>(v, value, child_mask, count);
+			in_mask |= child_mask;
+		}
+		filter_mask &= in_mask;
+		break;
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (!dynamic_filter.filter_data) {
+			break;
+		}
+		lock_guard<mutex> l(dynamic_filter.filter_data->lock);
+		if (dynamic_filter.filter_data->initialized) {
+			ApplyFilter(v, *dynamic_filter.filter_data->filter, filter_mask, count);
+		}
+		break;
+	}
 	default:
 		D_ASSERT(0);
 		break;
@@ -1151,6 +1203,10 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		}
 
 		result.Slice(state.sel, sel_size);
+		auto metrics = OperatorMetrics::Active();
+		if (metrics) {
+			metrics->rows_filtered += this_output_chunk_rows - sel_size;
+		}
 	} else {
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
 			auto file_col_idx = reader_data.column_ids[col_idx];
@@ -6,7 +6,9 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/parser/constraints/list.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 #include "duckdb/parser/parsed_data/create_table_info.hpp"
+#include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table_storage_info.hpp"
 #include "duckdb/planner/operator/logical_update.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
@@ -21,7 +23,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), order_by(info.order_by) {
 	this->temporary = info.temporary;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
@@ -69,6 +71,7 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	result->dependencies = dependencies;
 	std::for_each(constraints.begin(), constraints.end(),
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
+	result->order_by = order_by;
 	result->comment = comment;
 	result->tags = tags;
 	return std::move(result);
@@ -176,6 +179,20 @@ string TableCatalogEntry::ColumnsToSQL(const ColumnList &columns, const vector<u
 	return ss.str();
 }
 
+string TableCatalogEntry::OrderByToSQL(const vector<string> &order_by) {
+	if (order_by.empty()) {
+		return string();
+	}
+	string columns;
+	for (auto &column_name : order_by) {
+		if (!columns.empty()) {
+			columns += ", ";
+		}
+		columns += KeywordHelper::WriteOptionallyQuoted(column_name);
+	}
+	return " WITH (order_by = " + KeywordHelper::WriteQuoted(columns, '\'') + ")";
+}
+
 string TableCatalogEntry::ToSQL() const {
 	auto create_info = GetInfo();
 	return create_info->ToString();
@@ -193,6 +210,10 @@ const vector<unique_ptr<Constraint>> &TableCatalogEntry::GetConstraints() const
 	return constraints;
 }
 
+const vector<string> &TableCatalogEntry::GetOrderBy() const {
+	return order_by;
+}
+
 // LCOV_EXCL_START
 DataTable &TableCatalogEntry::GetStorage() {
 	throw InternalException("Calling GetStorage on a TableCatalogEntry that is not a DuckTableEntry");
@@ -305,6 +326,25 @@ void TableCatalogEntry::BindUpdateConstraints(Binder &binder, LogicalGet &get, L
 		}
 	}
 
+	// bulk updates that rewrite the entire table are also turned into a delete and an insert
+	// the new rows are written at append speed (directly to disk for large tables), and the checkpoint drops the
+	// fully deleted row groups - instead of building update chains that every scan has to merge until then
+	// the inserted rows are checked against indexes and foreign keys while the old rows are still there,
+	// so tables with indexes or foreign keys keep the regular update path
+	bool has_foreign_keys = false;
+	for (auto &constraint : bound_constraints) {
+		if (constraint->type == ConstraintType::FOREIGN_KEY) {
+			has_foreign_keys = true;
+			break;
+		}
+	}
+	if (proj.children[0].get() == &get && IsDuckTable() && table_storage_info.index_info.empty() &&
+	    !has_foreign_keys && GetStorage().GetTotalRows() >= Storage::ROW_GROUP_SIZE) {
+		// the update has no WHERE clause and no joins: every row is updated exactly once
+		update.update_is_del_and_insert = true;
+		update.update_rewrites_table = true;
+	}
+
 	if (update.update_is_del_and_insert) {
 		// the update updates a column required by an index or requires returning the updated rows,
 		// push projections for all columns
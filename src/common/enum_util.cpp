@@ -137,6 +137,7 @@
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table/chunk_info.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/temporary_file_manager.hpp"
 #include "duckdb/verification/statement_verifier.hpp"
 
 namespace duckdb {
@@ -1251,6 +1252,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1296,6 +1299,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -4238,6 +4244,30 @@ const char* EnumUtil::ToChars<MetricsType>(MetricsType value) {
 		return "OPERATOR_CARDINALITY";
 	case MetricsType::OPERATOR_TIMING:
 		return "OPERATOR_TIMING";
+	case MetricsType::BYTES_READ:
+		return "BYTES_READ";
+	case MetricsType::BYTES_WRITTEN:
+		return "BYTES_WRITTEN";
+	case MetricsType::ROWS_FILTERED:
+		return "ROWS_FILTERED";
+	case MetricsType::ROW_GROUPS_SKIPPED:
+		return "ROW_GROUPS_SKIPPED";
+	case MetricsType::SEGMENTS_SKIPPED:
+		return "SEGMENTS_SKIPPED";
+	case MetricsType::HASH_TABLE_SIZE:
+		return "HASH_TABLE_SIZE";
+	case MetricsType::HASH_TABLE_RESIZES:
+		return "HASH_TABLE_RESIZES";
+	case MetricsType::SPILL_BYTES:
+		return "SPILL_BYTES";
+	case MetricsType::BUFFER_PINS:
+		return "BUFFER_PINS";
+	case MetricsType::BUFFER_EVICTIONS:
+		return "BUFFER_EVICTIONS";
+	case MetricsType::IO_WAIT_TIME:
+		return "IO_WAIT_TIME";
+	case MetricsType::SCHEDULER_WAIT_TIME:
+		return "SCHEDULER_WAIT_TIME";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -4257,6 +4287,42 @@ MetricsType EnumUtil::FromString<MetricsType>(const char *value) {
 	if (StringUtil::Equals(value, "OPERATOR_TIMING")) {
 		return MetricsType::OPERATOR_TIMING;
 	}
+	if (StringUtil::Equals(value, "BYTES_READ")) {
+		return MetricsType::BYTES_READ;
+	}
+	if (StringUtil::Equals(value, "BYTES_WRITTEN")) {
+		return MetricsType::BYTES_WRITTEN;
+	}
+	if (StringUtil::Equals(value, "ROWS_FILTERED")) {
+		return MetricsType::ROWS_FILTERED;
+	}
+	if (StringUtil::Equals(value, "ROW_GROUPS_SKIPPED")) {
+		return MetricsType::ROW_GROUPS_SKIPPED;
+	}
+	if (StringUtil::Equals(value, "SEGMENTS_SKIPPED")) {
+		return MetricsType::SEGMENTS_SKIPPED;
+	}
+	if (StringUtil::Equals(value, "HASH_TABLE_SIZE")) {
+		return MetricsType::HASH_TABLE_SIZE;
+	}
+	if (StringUtil::Equals(value, "HASH_TABLE_RESIZES")) {
+		return MetricsType::HASH_TABLE_RESIZES;
+	}
+	if (StringUtil::Equals(value, "SPILL_BYTES")) {
+		return MetricsType::SPILL_BYTES;
+	}
+	if (StringUtil::Equals(value, "BUFFER_PINS")) {
+		return MetricsType::BUFFER_PINS;
+	}
+	if (StringUtil::Equals(value, "BUFFER_EVICTIONS")) {
+		return MetricsType::BUFFER_EVICTIONS;
+	}
+	if (StringUtil::Equals(value, "IO_WAIT_TIME")) {
+		return MetricsType::IO_WAIT_TIME;
+	}
+	if (StringUtil::Equals(value, "SCHEDULER_WAIT_TIME")) {
+		return MetricsType::SCHEDULER_WAIT_TIME;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -5014,6 +5080,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -5186,6 +5254,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -7056,6 +7127,12 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::BLOOM_FILTER:
+		return "BLOOM_FILTER";
+	case TableFilterType::IN_FILTER:
+		return "IN_FILTER";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -7081,6 +7158,15 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "BLOOM_FILTER")) {
+		return TableFilterType::BLOOM_FILTER;
+	}
+	if (StringUtil::Equals(value, "IN_FILTER")) {
+		return TableFilterType::IN_FILTER;
+	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -7246,6 +7332,95 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TaskSchedulerMode>(TaskSchedulerMode value) {
+	switch(value) {
+	case TaskSchedulerMode::GLOBAL_QUEUE:
+		return "GLOBAL_QUEUE";
+	case TaskSchedulerMode::WORK_STEALING:
+		return "WORK_STEALING";
+	case TaskSchedulerMode::NUMA_WORK_STEALING:
+		return "NUMA_WORK_STEALING";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TaskSchedulerMode EnumUtil::FromString<TaskSchedulerMode>(const char *value) {
+	if (StringUtil::Equals(value, "GLOBAL_QUEUE")) {
+		return TaskSchedulerMode::GLOBAL_QUEUE;
+	}
+	if (StringUtil::Equals(value, "WORK_STEALING")) {
+		return TaskSchedulerMode::WORK_STEALING;
+	}
+	if (StringUtil::Equals(value, "NUMA_WORK_STEALING")) {
+		return TaskSchedulerMode::NUMA_WORK_STEALING;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferCodec>(TemporaryBufferCodec value) {
+	switch(value) {
+	case TemporaryBufferCodec::UNCOMPRESSED:
+		return "UNCOMPRESSED";
+	case TemporaryBufferCodec::LZ4:
+		return "LZ4";
+	case TemporaryBufferCodec::ZSTD:
+		return "ZSTD";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryBufferCodec EnumUtil::FromString<TemporaryBufferCodec>(const char *value) {
+	if (StringUtil::Equals(value, "UNCOMPRESSED")) {
+		return TemporaryBufferCodec::UNCOMPRESSED;
+	}
+	if (StringUtil::Equals(value, "LZ4")) {
+		return TemporaryBufferCodec::LZ4;
+	}
+	if (StringUtil::Equals(value, "ZSTD")) {
+		return TemporaryBufferCodec::ZSTD;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TemporaryFileCompression>(TemporaryFileCompression value) {
+	switch(value) {
+	case TemporaryFileCompression::NONE:
+		return "NONE";
+	case TemporaryFileCompression::LZ4:
+		return "LZ4";
+	case TemporaryFileCompression::ZSTD:
+		return "ZSTD";
+	case TemporaryFileCompression::ADAPTIVE:
+		return "ADAPTIVE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryFileCompression EnumUtil::FromString<TemporaryFileCompression>(const char *value) {
+	if (StringUtil::Equals(value, "NONE")) {
+		return TemporaryFileCompression::NONE;
+	}
+	if (StringUtil::Equals(value, "LZ4")) {
+		return TemporaryFileCompression::LZ4;
+	}
+	if (StringUtil::Equals(value, "ZSTD")) {
+		return TemporaryFileCompression::ZSTD;
+	}
+	if (StringUtil::Equals(value, "ADAPTIVE")) {
+		return TemporaryFileCompression::ADAPTIVE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
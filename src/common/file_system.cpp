@@ -4,6 +4,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/windows.hpp"
 #include "duckdb/function/scalar/string_functions.hpp"
@@ -11,6 +12,7 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/profiling_info.hpp"
 #include "duckdb/common/windows_util.hpp"
 #include "duckdb/common/operator/multiply.hpp"
 
@@ -549,8 +551,29 @@ FileHandle::FileHandle(FileSystem &file_system, string path_p) : file_system(fil
 FileHandle::~FileHandle() {
 }
 
+//! Performs an I/O call, adding its size and duration to the metrics of the operator that is profiled on this thread
+template <bool IS_WRITE, class FUNC>
+static int64_t ProfileOperatorIO(FUNC &&io) {
+	auto metrics = OperatorMetrics::Active();
+	if (!metrics) {
+		return io();
+	}
+	Profiler timer;
+	timer.Start();
+	auto bytes = io();
+	timer.End();
+	if (IS_WRITE) {
+		metrics->bytes_written += NumericCast<idx_t>(MaxValue<int64_t>(bytes, 0));
+	} else {
+		metrics->bytes_read += NumericCast<idx_t>(MaxValue<int64_t>(bytes, 0));
+	}
+	metrics->io_wait_time += timer.Elapsed();
+	return bytes;
+}
+
 int64_t FileHandle::Read(void *buffer, idx_t nr_bytes) {
-	return file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes));
+	return ProfileOperatorIO<false>(
+	    [&]() { return file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes)); });
 }
 
 bool FileHandle::Trim(idx_t offset_bytes, idx_t length_bytes) {
@@ -558,15 +581,22 @@ bool FileHandle::Trim(idx_t offset_bytes, idx_t length_bytes) {
 }
 
 int64_t FileHandle::Write(void *buffer, idx_t nr_bytes) {
-	return file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes));
+	return ProfileOperatorIO<true>(
+	    [&]() { return file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes)); });
 }
 
 void FileHandle::Read(void *buffer, idx_t nr_bytes, idx_t location) {
-	file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
+	ProfileOperatorIO<false>([&]() {
+		file_system.Read(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
+		return UnsafeNumericCast<int64_t>(nr_bytes);
+	});
 }
 
 void FileHandle::Write(void *buffer, idx_t nr_bytes, idx_t location) {
-	file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
+	ProfileOperatorIO<true>([&]() {
+		file_system.Write(*this, buffer, UnsafeNumericCast<int64_t>(nr_bytes), location);
+		return UnsafeNumericCast<int64_t>(nr_bytes);
+	});
 }
 
 void FileHandle::Seek(idx_t location) {
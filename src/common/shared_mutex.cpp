@@ -0,0 +1,44 @@
+#include "duckdb/common/shared_mutex.hpp"
+
+namespace duckdb {
+
+SharedMutex::SharedMutex() : active_readers(0), waiting_writers(0), active_writer(false) {
+}
+
+void SharedMutex::lock() {
+	unique_lock<mutex> guard(internal_lock);
+	waiting_writers++;
+	writers_cv.wait(guard, [&] { return !active_writer && active_readers == 0; });
+	waiting_writers--;
+	active_writer = true;
+}
+
+void SharedMutex::unlock() {
+	{
+		lock_guard<mutex> guard(internal_lock);
+		active_writer = false;
+	}
+	// prefer the next writer, but wake up the readers if there is none
+	writers_cv.notify_one();
+	readers_cv.notify_all();
+}
+
+void SharedMutex::lock_shared() {
+	unique_lock<mutex> guard(internal_lock);
+	readers_cv.wait(guard, [&] { return !active_writer && waiting_writers == 0; });
+	active_readers++;
+}
+
+void SharedMutex::unlock_shared() {
+	bool notify_writer;
+	{
+		lock_guard<mutex> guard(internal_lock);
+		active_readers--;
+		notify_writer = active_readers == 0 && waiting_writers > 0;
+	}
+	if (notify_writer) {
+		writers_cv.notify_one();
+	}
+}
+
+} // namespace duckdb
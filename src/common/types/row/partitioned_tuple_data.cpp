@@ -260,12 +260,43 @@ void PartitionedTupleData::Repartition(PartitionedTupleData &new_partitioned_dat
 		return;
 	}
 
+	RepartitionInternal(new_partitioned_data, 0, partitions.size());
+
+	count = 0;
+	data_size = 0;
+
+	Verify();
+}
+
+void PartitionedTupleData::Repartition(PartitionedTupleData &new_partitioned_data, const idx_t partition_start,
+                                       const idx_t partition_end) {
+	D_ASSERT(layout.GetTypes() == new_partitioned_data.layout.GetTypes());
+	D_ASSERT(partitions.size() < new_partitioned_data.partitions.size());
+	D_ASSERT(partition_start <= partition_end && partition_end <= partitions.size());
+
+	idx_t range_count = 0;
+	idx_t range_size = 0;
+	for (idx_t partition_idx = partition_start; partition_idx < partition_end; partition_idx++) {
+		range_count += partitions[partition_idx]->Count();
+		range_size += partitions[partition_idx]->SizeInBytes();
+	}
+
+	RepartitionInternal(new_partitioned_data, partition_start, partition_end);
+
+	// Other threads may be repartitioning other ranges of partitions concurrently
+	lock_guard<mutex> guard(lock);
+	count -= range_count;
+	data_size -= range_size;
+}
+
+void PartitionedTupleData::RepartitionInternal(PartitionedTupleData &new_partitioned_data, const idx_t partition_start,
+                                               const idx_t partition_end) {
 	PartitionedTupleDataAppendState append_state;
 	new_partitioned_data.InitializeAppendState(append_state);
 
 	const auto reverse = RepartitionReverseOrder();
-	const idx_t start_idx = reverse ? partitions.size() : 0;
-	const idx_t end_idx = reverse ? 0 : partitions.size();
+	const idx_t start_idx = reverse ? partition_end : partition_start;
+	const idx_t end_idx = reverse ? partition_start : partition_end;
 	const int64_t update = reverse ? -1 : 1;
 	const int64_t adjustment = reverse ? -1 : 0;
 
@@ -285,11 +316,6 @@ void PartitionedTupleData::Repartition(PartitionedTupleData &new_partitioned_dat
 		partitions[actual_partition_idx]->Reset();
 	}
 	new_partitioned_data.FlushAppendState(append_state);
-
-	count = 0;
-	data_size = 0;
-
-	Verify();
 }
 
 void PartitionedTupleData::Unpin() {
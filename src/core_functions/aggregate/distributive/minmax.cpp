@@ -19,35 +19,61 @@ struct MinMaxState {
 	bool isset;
 };
 
+//! Reduces flat vectors without NULLs to a single minimum/maximum before comparing it with the state. The loop is
+//! branch-free and does not touch the state, so the compiler can vectorize it for the numeric types
+template <class OP>
+struct MinMaxFlatOperation {
+	template <class STATE, class INPUT_TYPE>
+	static void Update(STATE &state, const INPUT_TYPE *__restrict idata, idx_t count) {
+		auto value = idata[0];
+		for (idx_t i = 1; i < count; i++) {
+			value = OP::template Select<INPUT_TYPE>(idata[i], value);
+		}
+		if (!state.isset) {
+			state.value = value;
+			state.isset = true;
+		} else {
+			state.value = OP::template Select<INPUT_TYPE>(value, state.value);
+		}
+	}
+};
+
+template <class OP, class T>
+static AggregateFunction GetNumericUnaryAggregate(const LogicalType &type) {
+	auto function = AggregateFunction::UnaryAggregate<MinMaxState<T>, T, T, OP>(type, type);
+	function.simple_update = AggregateFunction::UnaryFlatUpdate<MinMaxState<T>, T, OP, MinMaxFlatOperation<OP>>;
+	return function;
+}
+
 template <class OP>
 static AggregateFunction GetUnaryAggregate(LogicalType type) {
 	switch (type.InternalType()) {
 	case PhysicalType::BOOL:
 		return AggregateFunction::UnaryAggregate<MinMaxState<int8_t>, int8_t, int8_t, OP>(type, type);
 	case PhysicalType::INT8:
-		return AggregateFunction::UnaryAggregate<MinMaxState<int8_t>, int8_t, int8_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, int8_t>(type);
 	case PhysicalType::INT16:
-		return AggregateFunction::UnaryAggregate<MinMaxState<int16_t>, int16_t, int16_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, int16_t>(type);
 	case PhysicalType::INT32:
-		return AggregateFunction::UnaryAggregate<MinMaxState<int32_t>, int32_t, int32_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, int32_t>(type);
 	case PhysicalType::INT64:
-		return AggregateFunction::UnaryAggregate<MinMaxState<int64_t>, int64_t, int64_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, int64_t>(type);
 	case PhysicalType::UINT8:
-		return AggregateFunction::UnaryAggregate<MinMaxState<uint8_t>, uint8_t, uint8_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, uint8_t>(type);
 	case PhysicalType::UINT16:
-		return AggregateFunction::UnaryAggregate<MinMaxState<uint16_t>, uint16_t, uint16_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, uint16_t>(type);
 	case PhysicalType::UINT32:
-		return AggregateFunction::UnaryAggregate<MinMaxState<uint32_t>, uint32_t, uint32_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, uint32_t>(type);
 	case PhysicalType::UINT64:
-		return AggregateFunction::UnaryAggregate<MinMaxState<uint64_t>, uint64_t, uint64_t, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, uint64_t>(type);
 	case PhysicalType::INT128:
 		return AggregateFunction::UnaryAggregate<MinMaxState<hugeint_t>, hugeint_t, hugeint_t, OP>(type, type);
 	case PhysicalType::UINT128:
 		return AggregateFunction::UnaryAggregate<MinMaxState<uhugeint_t>, uhugeint_t, uhugeint_t, OP>(type, type);
 	case PhysicalType::FLOAT:
-		return AggregateFunction::UnaryAggregate<MinMaxState<float>, float, float, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, float>(type);
 	case PhysicalType::DOUBLE:
-		return AggregateFunction::UnaryAggregate<MinMaxState<double>, double, double, OP>(type, type);
+		return GetNumericUnaryAggregate<OP, double>(type);
 	case PhysicalType::INTERVAL:
 		return AggregateFunction::UnaryAggregate<MinMaxState<interval_t>, interval_t, interval_t, OP>(type, type);
 	default:
@@ -104,6 +130,11 @@ struct NumericMinMaxBase : public MinMaxBase {
 };
 
 struct MinOperation : public NumericMinMaxBase {
+	template <class T>
+	static T Select(T input, T current) {
+		return LessThan::Operation<T>(input, current) ? input : current;
+	}
+
 	template <class INPUT_TYPE, class STATE>
 	static void Execute(STATE &state, INPUT_TYPE input, AggregateInputData &) {
 		if (LessThan::Operation<INPUT_TYPE>(input, state.value)) {
@@ -127,6 +158,11 @@ struct MinOperation : public NumericMinMaxBase {
 };
 
 struct MaxOperation : public NumericMinMaxBase {
+	template <class T>
+	static T Select(T input, T current) {
+		return GreaterThan::Operation<T>(input, current) ? input : current;
+	}
+
 	template <class INPUT_TYPE, class STATE>
 	static void Execute(STATE &state, INPUT_TYPE input, AggregateInputData &) {
 		if (GreaterThan::Operation<INPUT_TYPE>(input, state.value)) {
@@ -69,6 +69,58 @@ struct HugeintSumOperation : public BaseSumOperation<SumSetOperation, HugeintAdd
 	}
 };
 
+//! Sums flat integer vectors without NULLs in blocks. Every block is reduced into a 64-bit accumulator by a loop that
+//! neither touches the state nor handles overflow, which the compiler can vectorize
+struct IntegerSumFlatOperation {
+	template <class T>
+	static int64_t SumBlock(const T *__restrict idata, idx_t count) {
+		int64_t total = 0;
+		for (idx_t i = 0; i < count; i++) {
+			total += idata[i];
+		}
+		return total;
+	}
+
+	//! Sums the (unsigned) lower and (signed) upper 32 bits of the values separately, neither sum can overflow
+	static hugeint_t SumBlockToHugeint(const int64_t *__restrict idata, idx_t count) {
+		uint64_t lower = 0;
+		int64_t upper = 0;
+		for (idx_t i = 0; i < count; i++) {
+			lower += static_cast<uint32_t>(idata[i]);
+			upper += idata[i] >> 32;
+		}
+		// upper * 2^32 as a hugeint
+		hugeint_t result(upper >> 32, static_cast<uint64_t>(upper) << 32);
+		return result + hugeint_t(UnsafeNumericCast<int64_t>(lower));
+	}
+
+	template <class T>
+	static void AddBlock(int64_t &value, const T *idata, idx_t count) {
+		value += SumBlock<T>(idata, count);
+	}
+
+	static void AddBlock(hugeint_t &value, const int32_t *idata, idx_t count) {
+		value += hugeint_t(SumBlock<int32_t>(idata, count));
+	}
+
+	static void AddBlock(hugeint_t &value, const int64_t *idata, idx_t count) {
+		value += SumBlockToHugeint(idata, count);
+	}
+
+	template <class STATE, class INPUT_TYPE>
+	static void Update(STATE &state, const INPUT_TYPE *idata, idx_t count) {
+		for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+			AddBlock(state.value, idata + offset, MinValue<idx_t>(count - offset, STANDARD_VECTOR_SIZE));
+		}
+		state.isset = true;
+	}
+};
+
+template <class STATE, class INPUT_TYPE, class OP>
+static void SetFlatUpdate(AggregateFunction &function) {
+	function.simple_update = AggregateFunction::UnaryFlatUpdate<STATE, INPUT_TYPE, OP, IntegerSumFlatOperation>;
+}
+
 unique_ptr<FunctionData> SumNoOverflowBind(ClientContext &context, AggregateFunction &function,
                                            vector<unique_ptr<Expression>> &arguments) {
 	throw BinderException("sum_no_overflow is for internal use only!");
@@ -88,6 +140,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT32: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
+		SetFlatUpdate<SumState<int64_t>, int32_t, IntegerSumOperation>(function);
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -98,6 +151,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 	case PhysicalType::INT64: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
+		SetFlatUpdate<SumState<int64_t>, int64_t, IntegerSumOperation>(function);
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
@@ -158,6 +212,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		SetFlatUpdate<SumState<int64_t>, int16_t, IntegerSumOperation>(function);
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -166,6 +221,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		SetFlatUpdate<SumState<hugeint_t>, int32_t, SumToHugeintOperation>(function);
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -174,6 +230,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		SetFlatUpdate<SumState<hugeint_t>, int64_t, SumToHugeintOperation>(function);
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
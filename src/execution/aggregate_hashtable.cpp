@@ -10,6 +10,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/ht_entry.hpp"
+#include "duckdb/main/profiling_info.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 
 namespace duckdb {
@@ -41,7 +42,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -150,7 +152,7 @@ void GroupedAggregateHashTable::Verify() {
 		D_ASSERT(entry.GetSalt() == ht_entry_t::ExtractSalt(hash));
 		total_count++;
 	}
-	D_ASSERT(total_count == Count());
+	D_ASSERT(total_count == (skip_lookups ? 0 : Count()));
 #endif
 }
 
@@ -162,6 +164,14 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::SkipLookups() {
+	skip_lookups = true;
+}
+
+bool GroupedAggregateHashTable::SkipsLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -173,6 +183,14 @@ void GroupedAggregateHashTable::Resize(idx_t size) {
 		throw InternalException("Cannot downsize a hash table!");
 	}
 
+	auto metrics = OperatorMetrics::Active();
+	if (metrics) {
+		if (capacity != 0) {
+			metrics->hash_table_resizes++;
+		}
+		metrics->hash_table_size += (size - capacity) * sizeof(ht_entry_t);
+	}
+
 	capacity = size;
 	hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 	entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
@@ -326,20 +344,6 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	addresses_v.Flatten(groups.size());
 	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
 
-	// Compute the entry in the table based on the hash using a modulo,
-	// and precompute the hash salts for faster comparison below
-	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
-	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
-	for (idx_t r = 0; r < groups.size(); r++) {
-		const auto &hash = hashes[r];
-		ht_offsets[r] = ApplyBitMask(hash);
-		D_ASSERT(ht_offsets[r] == hash % capacity);
-		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
-	}
-
-	// we start out with all entries [0, 1, 2, ..., groups.size()]
-	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
-
 	// Make a chunk that references the groups and the hashes and convert to unified format
 	if (state.group_chunk.ColumnCount() == 0) {
 		state.group_chunk.InitializeEmpty(layout.GetTypes());
@@ -359,6 +363,37 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Every row becomes a new group, the duplicates are combined when the partitions are finalized
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk,
+		                                *FlatVector::IncrementalSelectionVector(), groups.size());
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, *FlatVector::IncrementalSelectionVector(),
+		                                groups.size());
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		count += groups.size();
+		return groups.size();
+	}
+
+	// Compute the entry in the table based on the hash using a modulo,
+	// and precompute the hash salts for faster comparison below
+	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
+	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
+	for (idx_t r = 0; r < groups.size(); r++) {
+		const auto &hash = hashes[r];
+		ht_offsets[r] = ApplyBitMask(hash);
+		D_ASSERT(ht_offsets[r] == hash % capacity);
+		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
+	}
+
+	// we start out with all entries [0, 1, 2, ..., groups.size()]
+	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -0,0 +1,94 @@
+#include "duckdb/execution/heavy_hitter_sketch.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+
+namespace duckdb {
+
+HeavyHitterSketch::HeavyHitterSketch() : sampled_count(0), sample_offset(0) {
+	counters.reserve(CAPACITY);
+}
+
+void HeavyHitterSketch::AddSampled(hash_t hash) {
+	sampled_count++;
+	for (auto &counter : counters) {
+		if (counter.first == hash) {
+			counter.second++;
+			return;
+		}
+	}
+	if (counters.size() < CAPACITY) {
+		counters.emplace_back(hash, 1);
+		return;
+	}
+	// no free counter: decrement all counters, and remove the ones that drop to zero
+	idx_t remaining = 0;
+	for (idx_t i = 0; i < counters.size(); i++) {
+		if (--counters[i].second > 0) {
+			counters[remaining++] = counters[i];
+		}
+	}
+	counters.resize(remaining);
+}
+
+void HeavyHitterSketch::Add(const UnifiedVectorFormat &hashes, const SelectionVector &sel, idx_t count) {
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hashes);
+	idx_t i;
+	for (i = sample_offset; i < count; i += SAMPLE_RATE) {
+		AddSampled(hash_data[hashes.sel->get_index(sel.get_index(i))]);
+	}
+	sample_offset = i - count;
+}
+
+void HeavyHitterSketch::Merge(const HeavyHitterSketch &other) {
+	sampled_count += other.sampled_count;
+	for (auto &other_counter : other.counters) {
+		bool found = false;
+		for (auto &counter : counters) {
+			if (counter.first == other_counter.first) {
+				counter.second += other_counter.second;
+				found = true;
+				break;
+			}
+		}
+		if (!found) {
+			counters.push_back(other_counter);
+		}
+	}
+	if (counters.size() <= CAPACITY) {
+		return;
+	}
+	// too many counters: keep the largest ones, minus the largest count that does not fit
+	std::sort(counters.begin(), counters.end(),
+	          [](const pair<hash_t, idx_t> &lhs, const pair<hash_t, idx_t> &rhs) { return lhs.second > rhs.second; });
+	const auto subtract = counters[CAPACITY].second;
+	counters.resize(CAPACITY);
+	idx_t remaining = 0;
+	for (idx_t i = 0; i < counters.size(); i++) {
+		if (counters[i].second > subtract) {
+			counters[remaining] = counters[i];
+			counters[remaining++].second -= subtract;
+		}
+	}
+	counters.resize(remaining);
+}
+
+bool HeavyHitterSketch::IsHeavyHitter(idx_t sampled_frequency) const {
+	return sampled_frequency * HEAVY_HITTER_FRACTION >= sampled_count &&
+	       sampled_frequency * SAMPLE_RATE >= MINIMUM_HEAVY_HITTER_COUNT;
+}
+
+bool HeavyHitterSketch::HasHeavyHitters() const {
+	return MaxHeavyHitterCount() > 0;
+}
+
+idx_t HeavyHitterSketch::MaxHeavyHitterCount() const {
+	idx_t result = 0;
+	for (auto &counter : counters) {
+		if (IsHeavyHitter(counter.second)) {
+			result = MaxValue<idx_t>(result, counter.second * SAMPLE_RATE);
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -933,7 +933,7 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	if (scan_state.values[1].IsNull()) {
 
 		// single predicate
-		lock_guard<mutex> l(lock);
+		SharedLockGuard l(lock);
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			success = SearchEqual(key, max_count, row_ids);
@@ -957,7 +957,7 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	} else {
 
 		// two predicates
-		lock_guard<mutex> l(lock);
+		SharedLockGuard l(lock);
 
 		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
@@ -1040,8 +1040,8 @@ string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, cons
 
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
 
-	// don't alter the index during constraint checking
-	lock_guard<mutex> l(lock);
+	// don't alter the index during constraint checking, but allow concurrent lookups
+	SharedLockGuard l(lock);
 
 	// first resolve the expressions for the index
 	DataChunk expression_chunk;
@@ -0,0 +1,273 @@
+#include "duckdb/execution/index/bloom/bloom_index.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+BloomIndex::BloomIndex(const string &name, const IndexConstraintType index_constraint_type,
+                       const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                       const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+                       const IndexStorageInfo &info)
+    : BoundIndex(name, BloomIndex::TYPE_NAME, index_constraint_type, column_ids, table_io_manager,
+                 unbound_expressions, db),
+      filter_count(0) {
+
+	if (index_constraint_type != IndexConstraintType::NONE) {
+		throw NotImplementedException("BLOOM indexes do not support UNIQUE or PRIMARY KEY constraints");
+	}
+	if (logical_types.size() != 1) {
+		throw NotImplementedException("BLOOM indexes only support a single key column");
+	}
+	if (logical_types[0].IsNested()) {
+		throw InvalidTypeException(logical_types[0], "Invalid type for index key.");
+	}
+
+	// every filter is the only segment of a buffer: the largest power of two that fits into a buffer
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	filter_size = NextPowerOfTwo(block_manager.GetBlockSize() - sizeof(validity_t)) / 2;
+	rows_per_filter = filter_size * 8 / BITS_PER_ROW;
+	allocator = make_uniq<FixedSizeAllocator>(filter_size, block_manager);
+
+	// deserialize lazily
+	if (info.IsValid()) {
+		D_ASSERT(info.allocator_infos.size() == 1);
+		filter_count = info.root;
+		allocator->Init(info.allocator_infos[0]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Insert / Append
+//===--------------------------------------------------------------------===//
+
+uint64_t *BloomIndex::GetOrCreateFilter(idx_t filter_idx) {
+	// buffer IDs are handed out densely, so allocating the filters in order of their ranges
+	// places the filter of each range in the buffer with the same ID
+	while (filter_count <= filter_idx) {
+		auto ptr = allocator->New();
+		D_ASSERT(ptr.GetBufferId() == filter_count && ptr.GetOffset() == 0);
+		(void)ptr;
+		filter_count++;
+	}
+	return allocator->Get<uint64_t>(IndexPointer(UnsafeNumericCast<uint32_t>(filter_idx), 0));
+}
+
+void BloomIndex::InsertHashes(IndexLock &lock, Vector &keys, Vector &hashes, Vector &row_identifiers, idx_t count) {
+	UnifiedVectorFormat key_data;
+	keys.ToUnifiedFormat(count, key_data);
+	UnifiedVectorFormat hash_data;
+	hashes.ToUnifiedFormat(count, hash_data);
+	auto hash_ptr = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+	UnifiedVectorFormat row_id_data;
+	row_identifiers.ToUnifiedFormat(count, row_id_data);
+	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+
+	const auto block_mask = filter_size / sizeof(uint64_t) - 1;
+	idx_t current_filter_idx = DConstants::INVALID_INDEX;
+	uint64_t *filter = nullptr;
+	for (idx_t i = 0; i < count; i++) {
+		auto row_id = NumericCast<idx_t>(row_ids[row_id_data.sel->get_index(i)]);
+		auto filter_idx = row_id / rows_per_filter;
+		if (filter_idx != current_filter_idx) {
+			// consecutive rows almost always share a filter
+			filter = GetOrCreateFilter(filter_idx);
+			current_filter_idx = filter_idx;
+		}
+		if (!key_data.validity.RowIsValid(key_data.sel->get_index(i))) {
+			// NULL keys never match an equality predicate
+			continue;
+		}
+		auto hash = hash_ptr[hash_data.sel->get_index(i)];
+		filter[hash & block_mask] |= BloomFilter::GetMask(hash);
+	}
+}
+
+ErrorData BloomIndex::Insert(IndexLock &lock, DataChunk &data, Vector &row_identifiers) {
+	D_ASSERT(data.ColumnCount() == 1);
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(data.data[0], hashes, data.size());
+	InsertHashes(lock, data.data[0], hashes, row_identifiers, data.size());
+	return ErrorData();
+}
+
+ErrorData BloomIndex::Append(IndexLock &lock, DataChunk &appended_data, Vector &row_identifiers) {
+	DataChunk expression_result;
+	expression_result.Initialize(Allocator::DefaultAllocator(), logical_types);
+
+	// first resolve the expressions for the index
+	ExecuteExpressions(appended_data, expression_result);
+
+	// now insert into the index
+	return Insert(lock, expression_result, row_identifiers);
+}
+
+void BloomIndex::VerifyAppend(DataChunk &chunk) {
+}
+
+void BloomIndex::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+}
+
+void BloomIndex::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+}
+
+//===--------------------------------------------------------------------===//
+// Drop / Delete
+//===--------------------------------------------------------------------===//
+
+void BloomIndex::CommitDrop(IndexLock &index_lock) {
+	allocator->Reset();
+	filter_count = 0;
+}
+
+void BloomIndex::Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) {
+}
+
+//===--------------------------------------------------------------------===//
+// Filter checks
+//===--------------------------------------------------------------------===//
+
+bool BloomIndex::MightContain(idx_t row_start, idx_t count, hash_t hash) {
+	const auto block_mask = filter_size / sizeof(uint64_t) - 1;
+	const auto mask = BloomFilter::GetMask(hash);
+
+	SharedLockGuard guard(lock);
+	auto first_filter_idx = row_start / rows_per_filter;
+	auto last_filter_idx = (row_start + count - 1) / rows_per_filter;
+	for (idx_t filter_idx = first_filter_idx; filter_idx <= last_filter_idx; filter_idx++) {
+		if (filter_idx >= filter_count) {
+			// rows that are not (yet) part of the index can contain anything
+			return true;
+		}
+		auto filter = allocator->Get<const uint64_t>(IndexPointer(UnsafeNumericCast<uint32_t>(filter_idx), 0), false);
+		if ((filter[hash & block_mask] & mask) == mask) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool BloomIndex::MightContain(idx_t row_start, idx_t count, const Value &value) {
+	if (value.IsNull() || value.type() != logical_types[0]) {
+		return true;
+	}
+	Vector key(value);
+	Vector hash(LogicalType::HASH);
+	VectorOperations::Hash(key, hash, 1);
+	return MightContain(row_start, count, ConstantVector::GetData<hash_t>(hash)[0]);
+}
+
+FilterPropagateResult BloomIndex::CheckFilter(column_t column_index, TableFilter &filter, idx_t row_start,
+                                              idx_t count) {
+	if (count == 0 || column_ids[0] != column_index ||
+	    unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    MightContain(row_start, count, constant_filter.constant)) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		for (auto &value : in_filter.values) {
+			if (MightContain(row_start, count, value)) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_filter.child_filters) {
+			if (CheckFilter(column_index, *child_filter, row_start, count) ==
+			    FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Helper functions for (de)serialization
+//===--------------------------------------------------------------------===//
+
+IndexStorageInfo BloomIndex::GetStorageInfo(const bool get_buffers) {
+
+	// the root is the number of filters
+	IndexStorageInfo info;
+	info.name = name;
+	info.root = filter_count;
+
+	if (!get_buffers) {
+		// store the data on disk as partial blocks and set the block ids
+		auto &block_manager = table_io_manager.GetIndexBlockManager();
+		PartialBlockManager partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT);
+		allocator->SerializeBuffers(partial_block_manager);
+		partial_block_manager.FlushPartialBlocks();
+
+	} else {
+		// set the correct allocation sizes and get the map containing all buffers
+		info.buffers.push_back(allocator->InitSerializationToWAL());
+	}
+
+	info.allocator_infos.push_back(allocator->GetInfo());
+	return info;
+}
+
+//===--------------------------------------------------------------------===//
+// Merging / Vacuum
+//===--------------------------------------------------------------------===//
+
+bool BloomIndex::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+	auto &other = other_index.Cast<BloomIndex>();
+	D_ASSERT(filter_size == other.filter_size);
+
+	const auto block_count = filter_size / sizeof(uint64_t);
+	for (idx_t filter_idx = 0; filter_idx < other.filter_count; filter_idx++) {
+		auto filter = GetOrCreateFilter(filter_idx);
+		auto other_filter =
+		    other.allocator->Get<const uint64_t>(IndexPointer(UnsafeNumericCast<uint32_t>(filter_idx), 0), false);
+		for (idx_t i = 0; i < block_count; i++) {
+			filter[i] |= other_filter[i];
+		}
+	}
+	return true;
+}
+
+void BloomIndex::Vacuum(IndexLock &state) {
+}
+
+idx_t BloomIndex::GetInMemorySize(IndexLock &index_lock) {
+	return allocator->GetInMemorySize();
+}
+
+//===--------------------------------------------------------------------===//
+// Utility
+//===--------------------------------------------------------------------===//
+
+string BloomIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	return StringUtil::Format("BLOOM: %llu filters of %llu rows", filter_count, rows_per_filter);
+}
+
+string BloomIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                 DataChunk &input) {
+	throw InternalException("BLOOM indexes do not have constraints that can be violated");
+}
+
+constexpr const char *BloomIndex::TYPE_NAME;
+
+} // namespace duckdb
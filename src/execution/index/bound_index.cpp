@@ -24,12 +24,11 @@ BoundIndex::BoundIndex(const string &name, const string &index_type, IndexConstr
 		logical_types.push_back(expr->return_type);
 		unbound_expressions.emplace_back(expr->Copy());
 		bound_expressions.push_back(BindExpression(expr->Copy()));
-		executor.AddExpression(*bound_expressions.back());
 	}
 }
 
 void BoundIndex::InitializeLock(IndexLock &state) {
-	state.index_lock = unique_lock<mutex>(lock);
+	state.index_lock = unique_lock<SharedMutex>(lock);
 }
 
 ErrorData BoundIndex::Append(DataChunk &entries, Vector &row_identifiers) {
@@ -75,6 +74,8 @@ idx_t BoundIndex::GetInMemorySize() {
 }
 
 void BoundIndex::ExecuteExpressions(DataChunk &input, DataChunk &result) {
+	// readers can execute the expressions concurrently, so every call uses its own executor
+	ExpressionExecutor executor(bound_expressions);
 	executor.Execute(input, result);
 }
 
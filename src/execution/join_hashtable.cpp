@@ -6,6 +6,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
@@ -113,6 +114,7 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	{
 		lock_guard<mutex> guard(data_lock);
 		data_collection->Combine(*other.data_collection);
+		heavy_hitters.Merge(other.heavy_hitters);
 	}
 
 	if (join_type == JoinType::MARK) {
@@ -404,7 +406,9 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
-	hash_values.ToUnifiedFormat(source_chunk.size(), append_state.chunk_state.vector_data.back().unified);
+	auto &hash_data = append_state.chunk_state.vector_data.back().unified;
+	hash_values.ToUnifiedFormat(source_chunk.size(), hash_data);
+	heavy_hitters.Add(hash_data, *current_sel, added_count);
 
 	// We already called TupleDataCollection::ToUnifiedFormat, so we can AppendUnified here
 	sink_collection->AppendUnified(append_state, source_chunk, *current_sel, added_count);
@@ -703,12 +707,31 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			bloom_filter->InsertHashes(hash_data, count);
+		}
 		TupleDataChunkState &chunk_state = iterator.GetChunkState();
 
 		InsertHashes(hashes, count, chunk_state, insert_state, parallel);
 	} while (iterator.Next());
 }
 
+void JoinHashTable::FillBloomFilter() {
+	D_ASSERT(bloom_filter);
+	Vector hashes(LogicalType::HASH);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	TupleDataChunkIterator iterator(*data_collection, TupleDataPinProperties::KEEP_EVERYTHING_PINNED, false);
+	const auto row_locations = iterator.GetRowLocations();
+	do {
+		const auto count = iterator.GetCurrentChunkCount();
+		for (idx_t i = 0; i < count; i++) {
+			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
+		}
+		bloom_filter->InsertHashes(hash_data, count);
+	} while (iterator.Next());
+}
+
 void JoinHashTable::InitializeScanStructure(ScanStructure &scan_structure, DataChunk &keys,
                                             TupleDataChunkState &key_state, const SelectionVector *&current_sel) {
 	D_ASSERT(Count() > 0); // should be handled before
@@ -751,6 +774,7 @@ void JoinHashTable::Probe(ScanStructure &scan_structure, DataChunk &keys, TupleD
 ScanStructure::ScanStructure(JoinHashTable &ht_p, TupleDataChunkState &key_state_p)
     : key_state(key_state_p), pointers(LogicalType::POINTER), sel_vector(STANDARD_VECTOR_SIZE),
       chain_match_sel_vector(STANDARD_VECTOR_SIZE), chain_no_match_sel_vector(STANDARD_VECTOR_SIZE),
+      lhs_sel_vector(STANDARD_VECTOR_SIZE), rhs_pointers(LogicalType::POINTER),
       found_match(make_unsafe_uniq_array_uninitialized<bool>(STANDARD_VECTOR_SIZE)), ht(ht_p), finished(false),
       is_null(true) {
 }
@@ -884,6 +908,10 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 		// no pointers left to chase
 		return;
 	}
+	if (ht.chains_longer_than_one && ht.join_type != JoinType::RIGHT_SEMI && ht.join_type != JoinType::RIGHT_ANTI) {
+		NextCompactedInnerJoin(keys, left, result);
+		return;
+	}
 
 	idx_t result_count = ScanInnerJoin(keys, chain_match_sel_vector);
 
@@ -918,6 +946,42 @@ void ScanStructure::NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &r
 	}
 }
 
+void ScanStructure::NextCompactedInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &result) {
+	// with long chains (e.g., a heavy hitter in the build side) only few probe rows still have pointers to follow
+	// instead of emitting a sparse chunk per link of the chains, we keep following the chains until the result is full
+	auto ptrs = FlatVector::GetData<data_ptr_t>(pointers);
+	auto rhs_ptrs = FlatVector::GetData<data_ptr_t>(rhs_pointers);
+	idx_t result_count = 0;
+	while (this->count > 0 && result_count + this->count <= STANDARD_VECTOR_SIZE) {
+		idx_t match_count = ScanInnerJoin(keys, chain_match_sel_vector);
+		for (idx_t i = 0; i < match_count; i++) {
+			auto idx = chain_match_sel_vector.get_index(i);
+			if (PropagatesBuildSide(ht.join_type)) {
+				// full/right outer join: mark join matches as FOUND in the HT
+				Store<bool>(true, ptrs[idx] + ht.tuple_size);
+			}
+			lhs_sel_vector.set_index(result_count + i, idx);
+			rhs_ptrs[result_count + i] = ptrs[idx];
+		}
+		result_count += match_count;
+		AdvancePointers();
+	}
+	if (result_count == 0) {
+		return;
+	}
+
+	// on the LHS, a probe row is repeated for every match in its chain
+	result.Slice(left, lhs_sel_vector, result_count);
+	// on the RHS, we fetch the data of the matches from the hash table
+	for (idx_t i = 0; i < ht.output_columns.size(); i++) {
+		auto &vector = result.data[left.ColumnCount() + i];
+		const auto output_col_idx = ht.output_columns[i];
+		D_ASSERT(vector.GetType() == ht.layout.GetTypes()[output_col_idx]);
+		ht.data_collection->Gather(rhs_pointers, *FlatVector::IncrementalSelectionVector(), result_count,
+		                           output_col_idx, vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+	}
+}
+
 void ScanStructure::ScanKeyMatches(DataChunk &keys) {
 	// the semi-join, anti-join and mark-join we handle a differently from the inner join
 	// since there can be at most STANDARD_VECTOR_SIZE results
@@ -1351,17 +1415,54 @@ void JoinHashTable::Unpartition() {
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
-void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
-                                            const idx_t max_partition_size, const idx_t max_partition_count) {
+//! Estimate which part of the largest partition consists of heavy hitters, which cannot be split by adding radix bits
+static void EstimateHotPartitionPart(const HeavyHitterSketch &heavy_hitters, const idx_t max_partition_size,
+                                     const idx_t max_partition_count, idx_t &hot_size, idx_t &hot_count) {
+	hot_count = MinValue<idx_t>(heavy_hitters.MaxHeavyHitterCount(), max_partition_count);
+	hot_size = max_partition_count == 0 ? 0 : max_partition_size / max_partition_count * hot_count;
+}
+
+bool JoinHashTable::CanRepartition(const idx_t max_ht_size, const idx_t max_partition_size,
+                                   const idx_t max_partition_count) const {
+	if (radix_bits >= RadixPartitioning::MAX_RADIX_BITS) {
+		return false;
+	}
+	idx_t hot_size;
+	idx_t hot_count;
+	EstimateHotPartitionPart(heavy_hitters, max_partition_size, max_partition_count, hot_size, hot_count);
+	if (hot_count == 0) {
+		return true;
+	}
+	// Only worth it if the rows that can still be split do not fit already
+	const auto cold_ht_size = max_partition_size - hot_size + PointerTableSize(max_partition_count - hot_count);
+	return cold_ht_size > max_ht_size / 4;
+}
+
+unique_ptr<PartitionedTupleData> JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts,
+                                                                        const idx_t max_ht_size,
+                                                                        const idx_t max_partition_size,
+                                                                        const idx_t max_partition_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
+	D_ASSERT(radix_bits < RadixPartitioning::MAX_RADIX_BITS);
+
+	// all rows of a heavy hitter end up in the same partition, no matter how many radix bits we add
+	HeavyHitterSketch merged_heavy_hitters = heavy_hitters;
+	for (auto &local_ht : local_hts) {
+		merged_heavy_hitters.Merge(local_ht->heavy_hitters);
+	}
+	idx_t hot_size;
+	idx_t hot_count;
+	EstimateHotPartitionPart(merged_heavy_hitters, max_partition_size, max_partition_count, hot_size, hot_count);
+	const auto cold_count = double(max_partition_count - hot_count);
+	const auto cold_size = double(max_partition_size - hot_size);
 
 	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
 	idx_t added_bits = 1;
 	for (; added_bits < max_added_bits; added_bits++) {
 		double partition_multiplier = RadixPartitioning::NumberOfPartitions(added_bits);
 
-		auto new_estimated_size = double(max_partition_size) / partition_multiplier;
-		auto new_estimated_count = double(max_partition_count) / partition_multiplier;
+		auto new_estimated_size = double(hot_size) + cold_size / partition_multiplier;
+		auto new_estimated_count = double(hot_count) + cold_count / partition_multiplier;
 		auto new_estimated_ht_size =
 		    new_estimated_size + static_cast<double>(PointerTableSize(NumericCast<idx_t>(new_estimated_count)));
 
@@ -1369,10 +1470,19 @@ void JoinHashTable::SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &l
 			// Aim for an estimated partition size of max_ht_size / 4
 			break;
 		}
+		auto cold_estimated_ht_size =
+		    cold_size / partition_multiplier +
+		    static_cast<double>(PointerTableSize(NumericCast<idx_t>(cold_count / partition_multiplier)));
+		if (hot_count > 0 && cold_estimated_ht_size <= double(max_ht_size) / 4) {
+			// The partition is dominated by a heavy hitter: adding more bits only creates more (tiny) partitions
+			break;
+		}
 	}
 	radix_bits += added_bits;
+	auto old_sink_collection = std::move(sink_collection);
 	sink_collection =
 	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	return old_sink_collection;
 }
 
 void JoinHashTable::Repartition(JoinHashTable &global_ht) {
@@ -1383,6 +1493,14 @@ void JoinHashTable::Repartition(JoinHashTable &global_ht) {
 	global_ht.Merge(*this);
 }
 
+void JoinHashTable::Repartition(PartitionedTupleData &old_sink_collection, const idx_t partition_start,
+                                const idx_t partition_end) {
+	auto new_sink_collection =
+	    make_uniq<RadixPartitionedTupleData>(buffer_manager, layout, radix_bits, layout.ColumnCount() - 1);
+	old_sink_collection.Repartition(*new_sink_collection, partition_start, partition_end);
+	sink_collection->Combine(*new_sink_collection);
+}
+
 void JoinHashTable::Reset() {
 	data_collection->Reset();
 	hash_map.Reset();
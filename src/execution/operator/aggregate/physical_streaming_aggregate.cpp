@@ -0,0 +1,347 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/function/aggregate_function.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+}
+
+bool PhysicalStreamingAggregate::CanStreamAggregates(const vector<unique_ptr<Expression>> &aggregates) {
+	for (auto &expr : aggregates) {
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct() || aggregate.filter || aggregate.order_bys || !aggregate.function.update) {
+			return false;
+		}
+	}
+	return true;
+}
+
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &client, const PhysicalStreamingAggregate &op);
+	~StreamingAggregateState() override;
+
+	//! Sets is_start[offset + i] for every row i in [0, count) for which the keys in left and right differ
+	void MarkDistinctRows(DataChunk &left, DataChunk &right, idx_t count, idx_t offset);
+	//! Updates the states of rows [begin, end) of the current chunk
+	void UpdateStates(idx_t begin, idx_t end, ArenaAllocator &arena);
+	//! Initializes/finalizes/destroys the states of the groups in slots [begin, end)
+	void InitializeStates(idx_t begin, idx_t end);
+	void FinalizeStates(idx_t begin, idx_t end, DataChunk &result, idx_t result_offset);
+	void DestroyStates(idx_t begin, idx_t end);
+	//! Emits the keys of the open group into row 'row' of the result
+	void EmitOpenGroup(DataChunk &result, idx_t row);
+
+private:
+	Vector &GetStatePointers(idx_t begin, idx_t end, idx_t aggr_idx);
+
+public:
+	const PhysicalStreamingAggregate &op;
+	//! Executors for the group keys and the aggregate inputs
+	ExpressionExecutor group_executor;
+	ExpressionExecutor payload_executor;
+	DataChunk group_chunk;
+	DataChunk payload_chunk;
+	//! The group keys shifted by one row, and the aggregate inputs of the last group in the chunk
+	DataChunk shifted_groups;
+	DataChunk sliced_payload;
+
+	//! The keys of the group that is still open (i.e., that may continue in the next chunk)
+	DataChunk open_group;
+	bool has_open_group;
+
+	//! Offsets of the aggregate states within the states of a group, and the size of the states of a group
+	vector<idx_t> state_offsets;
+	idx_t state_width;
+	//! The states of the open group (in slot 0), followed by the states of the groups that start in the chunk
+	unsafe_unique_array<data_t> states;
+	//! The arena of the open group and the groups that finish in the current chunk, and the arena of the last group
+	//! that starts in the current chunk. The former is reset once these groups have been emitted
+	unique_ptr<ArenaAllocator> allocator;
+	unique_ptr<ArenaAllocator> next_allocator;
+
+	//! Whether a new group starts at a row, and the rows at which they start
+	bool is_start[STANDARD_VECTOR_SIZE];
+	SelectionVector group_starts;
+	//! The slot of the group every row belongs to
+	idx_t row_slots[STANDARD_VECTOR_SIZE];
+	//! Selection vectors to find the group boundaries
+	SelectionVector shift_sel;
+	SelectionVector slice_sel;
+	SelectionVector true_sel;
+	SelectionVector false_sels[2];
+	//! The pointers to the states that are updated/finalized
+	Vector addresses;
+};
+
+StreamingAggregateState::StreamingAggregateState(ClientContext &client, const PhysicalStreamingAggregate &op)
+    : op(op), group_executor(client), payload_executor(client), has_open_group(false), state_width(0),
+      allocator(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator())),
+      next_allocator(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator())), group_starts(STANDARD_VECTOR_SIZE),
+      shift_sel(STANDARD_VECTOR_SIZE), slice_sel(STANDARD_VECTOR_SIZE), true_sel(STANDARD_VECTOR_SIZE),
+      false_sels {SelectionVector(STANDARD_VECTOR_SIZE), SelectionVector(STANDARD_VECTOR_SIZE)},
+      addresses(LogicalType::POINTER) {
+	auto &buffer_allocator = Allocator::Get(client);
+
+	vector<LogicalType> group_types;
+	for (auto &group : op.groups) {
+		group_types.push_back(group->return_type);
+		group_executor.AddExpression(*group);
+	}
+	group_chunk.Initialize(buffer_allocator, group_types);
+	shifted_groups.InitializeEmpty(group_types);
+	open_group.Initialize(buffer_allocator, group_types, 1);
+
+	vector<LogicalType> payload_types;
+	for (auto &expr : op.aggregates) {
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		for (auto &child : aggregate.children) {
+			payload_types.push_back(child->return_type);
+			payload_executor.AddExpression(*child);
+		}
+		state_offsets.push_back(state_width);
+		state_width += AlignValue(aggregate.function.state_size());
+	}
+	if (!payload_types.empty()) {
+		payload_chunk.Initialize(buffer_allocator, payload_types);
+		sliced_payload.InitializeEmpty(payload_types);
+	}
+	const auto slot_count = STANDARD_VECTOR_SIZE + 1;
+	states = make_unsafe_uniq_array_uninitialized<data_t>(MaxValue<idx_t>(state_width, 1) * slot_count);
+
+	for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+		shift_sel.set_index(i, i + 1);
+	}
+}
+
+StreamingAggregateState::~StreamingAggregateState() {
+	if (has_open_group) {
+		DestroyStates(0, 1);
+	}
+}
+
+void StreamingAggregateState::MarkDistinctRows(DataChunk &left, DataChunk &right, idx_t count, idx_t offset) {
+	// Rows that are equal on the columns so far are compared on the next column
+	optional_ptr<const SelectionVector> sel;
+	idx_t remaining = count;
+	for (idx_t col_idx = 0; col_idx < left.ColumnCount() && remaining > 0; col_idx++) {
+		auto &false_sel = false_sels[col_idx % 2];
+		// The selection only maps the compared rows to the result, so the inputs have to be sliced to those rows
+		Vector left_col(left.data[col_idx]);
+		Vector right_col(right.data[col_idx]);
+		if (sel) {
+			left_col.Slice(*sel, remaining);
+			right_col.Slice(*sel, remaining);
+		}
+		const auto distinct_count =
+		    VectorOperations::DistinctFrom(left_col, right_col, sel, remaining, &true_sel, &false_sel);
+		for (idx_t i = 0; i < distinct_count; i++) {
+			is_start[offset + true_sel.get_index(i)] = true;
+		}
+		remaining -= distinct_count;
+		sel = &false_sel;
+	}
+}
+
+Vector &StreamingAggregateState::GetStatePointers(idx_t begin, idx_t end, idx_t aggr_idx) {
+	auto pointers = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t slot = begin; slot < end; slot++) {
+		pointers[slot - begin] = states.get() + slot * state_width + state_offsets[aggr_idx];
+	}
+	return addresses;
+}
+
+void StreamingAggregateState::InitializeStates(idx_t begin, idx_t end) {
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggregate = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (idx_t slot = begin; slot < end; slot++) {
+			aggregate.function.initialize(states.get() + slot * state_width + state_offsets[aggr_idx]);
+		}
+	}
+}
+
+void StreamingAggregateState::UpdateStates(idx_t begin, idx_t end, ArenaAllocator &arena) {
+	if (begin == end) {
+		return;
+	}
+	const auto count = end - begin;
+	auto payload = &payload_chunk;
+	if (begin != 0 && payload_chunk.ColumnCount() != 0) {
+		for (idx_t i = 0; i < count; i++) {
+			slice_sel.set_index(i, begin + i);
+		}
+		sliced_payload.Slice(payload_chunk, slice_sel, count);
+		payload = &sliced_payload;
+	}
+
+	idx_t payload_idx = 0;
+	auto pointers = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggregate = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (idx_t i = 0; i < count; i++) {
+			pointers[i] = states.get() + row_slots[begin + i] * state_width + state_offsets[aggr_idx];
+		}
+		const auto child_count = aggregate.children.size();
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), arena);
+		aggregate.function.update(child_count == 0 ? nullptr : &payload->data[payload_idx], aggr_input_data,
+		                          child_count, addresses, count);
+		payload_idx += child_count;
+	}
+}
+
+void StreamingAggregateState::FinalizeStates(idx_t begin, idx_t end, DataChunk &result, idx_t result_offset) {
+	if (begin == end) {
+		return;
+	}
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggregate = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), *allocator);
+		aggregate.function.finalize(GetStatePointers(begin, end, aggr_idx), aggr_input_data,
+		                            result.data[op.groups.size() + aggr_idx], end - begin, result_offset);
+	}
+}
+
+void StreamingAggregateState::DestroyStates(idx_t begin, idx_t end) {
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggregate = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		if (!aggregate.function.destructor) {
+			continue;
+		}
+		AggregateInputData aggr_input_data(aggregate.bind_info.get(), *allocator);
+		aggregate.function.destructor(GetStatePointers(begin, end, aggr_idx), aggr_input_data, end - begin);
+	}
+}
+
+void StreamingAggregateState::EmitOpenGroup(DataChunk &result, idx_t row) {
+	for (idx_t col_idx = 0; col_idx < open_group.ColumnCount(); col_idx++) {
+		result.SetValue(col_idx, row, open_group.GetValue(col_idx, 0));
+	}
+}
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	state.group_chunk.Reset();
+	state.group_executor.Execute(input, state.group_chunk);
+	if (state.payload_chunk.ColumnCount() != 0) {
+		state.payload_chunk.Reset();
+		state.payload_executor.Execute(input, state.payload_chunk);
+	}
+
+	// Find the rows at which a new group starts: either the keys differ from the keys of the previous row,
+	// or (for the first row) from the keys of the open group
+	std::fill_n(state.is_start, count, false);
+	if (state.has_open_group) {
+		state.MarkDistinctRows(state.group_chunk, state.open_group, 1, 0);
+	} else {
+		state.is_start[0] = true;
+	}
+	if (count > 1) {
+		state.shifted_groups.Slice(state.group_chunk, state.shift_sel, count - 1);
+		state.MarkDistinctRows(state.shifted_groups, state.group_chunk, count - 1, 1);
+	}
+
+	// The open group is in slot 0, the groups that start in this chunk get the slots after it
+	idx_t start_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (state.is_start[i]) {
+			state.group_starts.set_index(start_count++, i);
+		}
+		state.row_slots[i] = start_count;
+	}
+	state.InitializeStates(1, start_count + 1);
+
+	if (start_count == 0) {
+		// All rows belong to the open group
+		state.UpdateStates(0, count, *state.allocator);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// The last group that starts in this chunk stays open, it allocates from the next arena
+	const auto last_start = state.group_starts.get_index(start_count - 1);
+	state.UpdateStates(0, last_start, *state.allocator);
+	state.UpdateStates(last_start, count, *state.next_allocator);
+
+	// Emit the groups that are finished: the open group (if any) and all but the last group that starts in this chunk
+	const idx_t first_slot = state.has_open_group ? 0 : 1;
+	const idx_t finished_count = start_count - first_slot;
+	if (state.has_open_group) {
+		state.EmitOpenGroup(chunk, 0);
+	}
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		VectorOperations::Copy(state.group_chunk.data[col_idx], chunk.data[col_idx], state.group_starts,
+		                       start_count - 1, 0, first_slot == 0 ? 1 : 0);
+	}
+	state.FinalizeStates(first_slot, start_count, chunk, 0);
+	state.DestroyStates(first_slot, start_count);
+	chunk.SetCardinality(finished_count);
+
+	// Nothing references the arena of the finished groups anymore
+	state.allocator->Reset();
+	std::swap(state.allocator, state.next_allocator);
+
+	// Move the states of the last group to slot 0 and remember its keys
+	memcpy(state.states.get(), state.states.get() + start_count * state.state_width, state.state_width);
+	state.open_group.Reset();
+	for (idx_t col_idx = 0; col_idx < groups.size(); col_idx++) {
+		state.open_group.SetValue(col_idx, 0, state.group_chunk.GetValue(col_idx, last_start));
+	}
+	state.open_group.SetCardinality(1);
+	state.has_open_group = true;
+
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (state.has_open_group) {
+		state.EmitOpenGroup(chunk, 0);
+		state.FinalizeStates(0, 1, chunk, 0);
+		state.DestroyStates(0, 1);
+		state.has_open_group = false;
+		chunk.SetCardinality(1);
+	}
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+	}
+	result += "\n[INFOSEPARATOR]\n";
+	result += StringUtil::Format("EC: %llu\n", estimated_cardinality);
+	return result;
+}
+
+} // namespace duckdb
@@ -4,6 +4,7 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
 
@@ -93,6 +94,12 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
+	if (info->options.full) {
+		// the row groups are rewritten in clustering order by the next checkpoint
+		tbl->GetStorage().GetDataTableInfo()->SetRecluster(true);
+		// the table data itself is unchanged - make sure the next checkpoint is not skipped
+		StorageManager::Get(tbl->ParentCatalog()).RequestCheckpoint();
+	}
 
 	return SinkFinalizeType::READY;
 }
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
+#include "duckdb/common/types/value_map.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
@@ -14,7 +15,9 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -111,10 +114,12 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
 
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
-	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
-	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
+	    : op(op_p), context(context_p),
+	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
-	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0), scanned_data(false) {
+	      active_local_states(0), total_size(0), max_partition_size(0), max_partition_count(0),
+	      probe_side_requirement(0), scanned_data(false) {
 		hash_table = op.InitializeHashTable(context);
 
 		// For perfect hash join
@@ -134,8 +139,10 @@ public:
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	idx_t GetMaxHTSize() const;
 
 public:
+	const PhysicalHashJoin &op;
 	ClientContext &context;
 
 	const idx_t num_threads;
@@ -156,6 +163,8 @@ public:
 	idx_t total_size;
 	idx_t max_partition_size;
 	idx_t max_partition_count;
+	//! The part of the reservation that is set aside for partitioning the probe side
+	idx_t probe_side_requirement;
 
 	//! Hash tables built by each thread
 	mutex lock;
@@ -325,7 +334,13 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 	auto &gstate = input.global_state.Cast<HashJoinGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
-	lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
+	auto &sink_collection = lstate.hash_table->GetSinkCollection();
+	sink_collection.FlushAppendState(lstate.append_state);
+	auto metrics = context.thread.profiler.GetOperatorMetrics(*this);
+	if (metrics) {
+		metrics->hash_table_size +=
+		    sink_collection.SizeInBytes() + JoinHashTable::PointerTableSize(sink_collection.Count());
+	}
 	lock_guard<mutex> local_ht_lock(gstate.lock);
 	gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
 	if (gstate.local_hash_tables.size() == gstate.active_local_states) {
@@ -447,6 +462,9 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.global_filter_state && sink.global_filter_state->bloom_filter) {
+			sink.op.filter_pushdown->PushBloomFilter(*sink.global_filter_state, *sink.hash_table, sink.op);
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -469,6 +487,12 @@ void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	}
 }
 
+idx_t HashJoinGlobalSinkState::GetMaxHTSize() const {
+	// the HT of the next partitions gets what remains of the reservation after partitioning the probe side
+	const auto reservation = temporary_memory_state->GetReservation();
+	return reservation > probe_side_requirement ? reservation - probe_side_requirement : 0;
+}
+
 class HashJoinRepartitionTask : public ExecutorTask {
 public:
 	HashJoinRepartitionTask(shared_ptr<Event> event_p, ClientContext &context, JoinHashTable &global_ht,
@@ -487,16 +511,42 @@ private:
 	JoinHashTable &local_ht;
 };
 
+class HashJoinRecursiveRepartitionTask : public ExecutorTask {
+public:
+	HashJoinRecursiveRepartitionTask(shared_ptr<Event> event_p, ClientContext &context, JoinHashTable &global_ht,
+	                                 PartitionedTupleData &old_sink_collection, idx_t partition_start,
+	                                 idx_t partition_end)
+	    : ExecutorTask(context, std::move(event_p)), global_ht(global_ht), old_sink_collection(old_sink_collection),
+	      partition_start(partition_start), partition_end(partition_end) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		global_ht.Repartition(old_sink_collection, partition_start, partition_end);
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	JoinHashTable &global_ht;
+	PartitionedTupleData &old_sink_collection;
+	idx_t partition_start;
+	idx_t partition_end;
+};
+
 class HashJoinRepartitionEvent : public BasePipelineEvent {
 public:
 	HashJoinRepartitionEvent(Pipeline &pipeline_p, const PhysicalHashJoin &op_p, HashJoinGlobalSinkState &sink,
-	                         vector<unique_ptr<JoinHashTable>> &local_hts)
-	    : BasePipelineEvent(pipeline_p), op(op_p), sink(sink), local_hts(local_hts) {
+	                         vector<unique_ptr<JoinHashTable>> &local_hts,
+	                         unique_ptr<PartitionedTupleData> old_sink_collection_p = nullptr)
+	    : BasePipelineEvent(pipeline_p), op(op_p), sink(sink), local_hts(local_hts),
+	      old_sink_collection(std::move(old_sink_collection_p)) {
 	}
 
 	const PhysicalHashJoin &op;
 	HashJoinGlobalSinkState &sink;
 	vector<unique_ptr<JoinHashTable>> &local_hts;
+	//! The partitions of the global HT that turned out to be too large, if this is a recursive repartition round
+	unique_ptr<PartitionedTupleData> old_sink_collection;
 
 public:
 	void Schedule() override {
@@ -505,21 +555,52 @@ public:
 
 		idx_t total_size = 0;
 		idx_t total_count = 0;
+		if (old_sink_collection) {
+			total_size = old_sink_collection->SizeInBytes();
+			total_count = old_sink_collection->Count();
+		}
 		for (auto &local_ht : local_hts) {
 			auto &sink_collection = local_ht->GetSinkCollection();
 			total_size += sink_collection.SizeInBytes();
 			total_count += sink_collection.Count();
 		}
-		auto total_blocks = (total_size + block_size - 1) / block_size;
-		auto count_per_block = total_count / total_blocks;
+		auto total_blocks = MaxValue<idx_t>((total_size + block_size - 1) / block_size, 1);
+		auto count_per_block = MaxValue<idx_t>(total_count / total_blocks, 1);
 		auto blocks_per_vector = MaxValue<idx_t>(STANDARD_VECTOR_SIZE / count_per_block, 2);
 
 		// Assume 8 blocks per partition per thread (4 input, 4 output)
+		const auto old_radix_bits = old_sink_collection
+		                                ? old_sink_collection->Cast<RadixPartitionedTupleData>().GetRadixBits()
+		                                : JoinHashTable::INITIAL_RADIX_BITS;
 		auto partition_multiplier =
-		    RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits() - JoinHashTable::INITIAL_RADIX_BITS);
+		    RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits() - old_radix_bits);
 		auto thread_memory = 2 * blocks_per_vector * partition_multiplier * block_size;
 		auto repartition_threads = MaxValue<idx_t>(sink.temporary_memory_state->GetReservation() / thread_memory, 1);
 
+		auto &context = pipeline->GetClientContext();
+
+		vector<shared_ptr<Task>> partition_tasks;
+		if (old_sink_collection) {
+			// Recursive round: divide the (already partitioned) data into ranges of partitions of similar size
+			repartition_threads = MinValue<idx_t>(repartition_threads, sink.num_threads);
+			const auto size_per_task = MaxValue<idx_t>(total_size / repartition_threads, 1);
+			auto &partitions = old_sink_collection->GetPartitions();
+			idx_t partition_start = 0;
+			idx_t task_size = 0;
+			for (idx_t partition_idx = 0; partition_idx < partitions.size(); partition_idx++) {
+				task_size += partitions[partition_idx]->SizeInBytes();
+				if (task_size >= size_per_task || partition_idx + 1 == partitions.size()) {
+					partition_tasks.push_back(make_uniq<HashJoinRecursiveRepartitionTask>(
+					    shared_from_this(), context, *sink.hash_table, *old_sink_collection, partition_start,
+					    partition_idx + 1));
+					partition_start = partition_idx + 1;
+					task_size = 0;
+				}
+			}
+			SetTasks(std::move(partition_tasks));
+			return;
+		}
+
 		if (repartition_threads < local_hts.size()) {
 			// Limit the number of threads working on repartitioning based on our memory reservation
 			for (idx_t thread_idx = repartition_threads; thread_idx < local_hts.size(); thread_idx++) {
@@ -528,9 +609,6 @@ public:
 			local_hts.resize(repartition_threads);
 		}
 
-		auto &context = pipeline->GetClientContext();
-
-		vector<shared_ptr<Task>> partition_tasks;
 		partition_tasks.reserve(local_hts.size());
 		for (auto &local_ht : local_hts) {
 			partition_tasks.push_back(
@@ -541,27 +619,87 @@ public:
 
 	void FinishEvent() override {
 		local_hts.clear();
+		old_sink_collection.reset();
+
+		auto &ht = *sink.hash_table;
+		const auto previous_max_partition_count = sink.max_partition_count;
 
 		// Minimum reservation is now the new smallest partition size
-		const auto num_partitions = RadixPartitioning::NumberOfPartitions(sink.hash_table->GetRadixBits());
+		const auto num_partitions = RadixPartitioning::NumberOfPartitions(ht.GetRadixBits());
 		vector<idx_t> partition_sizes(num_partitions, 0);
 		vector<idx_t> partition_counts(num_partitions, 0);
-		sink.total_size = sink.hash_table->GetTotalSize(partition_sizes, partition_counts, sink.max_partition_size,
-		                                                sink.max_partition_count);
-		const auto probe_side_requirement =
-		    GetPartitioningSpaceRequirement(sink.context, op.types, sink.hash_table->GetRadixBits(), sink.num_threads);
-
-		sink.temporary_memory_state->SetMinimumReservation(sink.max_partition_size +
-		                                                   JoinHashTable::PointerTableSize(sink.max_partition_count) +
-		                                                   probe_side_requirement);
+		ht.GetSinkCollection().GetSizesAndCounts(partition_sizes, partition_counts);
+		sink.total_size =
+		    ht.GetTotalSize(partition_sizes, partition_counts, sink.max_partition_size, sink.max_partition_count);
+
+		// The radix bits were chosen based on an estimate, the largest partition may still not fit
+		const auto max_partition_ht_size =
+		    sink.max_partition_size + JoinHashTable::PointerTableSize(sink.max_partition_count);
+		const auto reservation = sink.temporary_memory_state->GetReservation();
+		if (max_partition_ht_size > reservation && sink.max_partition_count <= previous_max_partition_count / 2 &&
+		    ht.CanRepartition(reservation, sink.max_partition_size, sink.max_partition_count)) {
+			// Adding radix bits made the partitions smaller, so we recursively repartition with even more radix bits
+			auto old_sink = ht.SetRepartitionRadixBits(sink.local_hash_tables, reservation, sink.max_partition_size,
+			                                           sink.max_partition_count);
+			auto new_event = make_shared_ptr<HashJoinRepartitionEvent>(*pipeline, op, sink, sink.local_hash_tables,
+			                                                           std::move(old_sink));
+			InsertEvent(std::move(new_event));
+			return;
+		}
+
+		sink.probe_side_requirement =
+		    GetPartitioningSpaceRequirement(sink.context, op.types, ht.GetRadixBits(), sink.num_threads);
+
+		sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size + sink.probe_side_requirement);
 		sink.temporary_memory_state->UpdateReservation(executor.context);
 
-		sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+		ht.PrepareExternalFinalize(sink.GetMaxHTSize());
 		sink.ScheduleFinalize(*pipeline, *this);
 	}
 };
 
-void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const {
+static vector<vector<Value>> GetDistinctBuildKeys(JoinHashTable &ht, const vector<JoinFilterPushdownColumn> &filters) {
+	// the join keys are the first columns of the hash table layout
+	vector<column_t> key_columns;
+	for (auto &filter : filters) {
+		key_columns.push_back(filter.join_condition);
+	}
+	vector<value_set_t> distinct_keys(filters.size());
+
+	auto &data_collection = ht.GetDataCollection();
+	TupleDataScanState scan_state;
+	data_collection.InitializeScan(scan_state, key_columns, TupleDataPinProperties::UNPIN_AFTER_DONE);
+	DataChunk keys;
+	data_collection.InitializeScanChunk(scan_state, keys);
+	while (data_collection.Scan(scan_state, keys)) {
+		for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+			for (idx_t row_idx = 0; row_idx < keys.size(); row_idx++) {
+				auto key = keys.data[filter_idx].GetValue(row_idx);
+				if (!key.IsNull()) {
+					distinct_keys[filter_idx].insert(std::move(key));
+				}
+			}
+		}
+	}
+
+	vector<vector<Value>> result(filters.size());
+	for (idx_t filter_idx = 0; filter_idx < filters.size(); filter_idx++) {
+		auto &keys_for_filter = result[filter_idx];
+		keys_for_filter.insert(keys_for_filter.end(), distinct_keys[filter_idx].begin(),
+		                       distinct_keys[filter_idx].end());
+		std::sort(keys_for_filter.begin(), keys_for_filter.end());
+	}
+	return result;
+}
+
+void JoinFilterPushdownInfo::PushFilters(ClientContext &context, JoinHashTable &ht, JoinFilterGlobalState &gstate,
+                                         const PhysicalOperator &op) const {
+	// if the build side is small enough, we push the exact set of keys instead of only their range
+	vector<vector<Value>> in_filter_keys;
+	if (ht.Count() <= ClientConfig::GetConfig(context).dynamic_in_filter_threshold) {
+		in_filter_keys = GetDistinctBuildKeys(ht, filters);
+	}
+
 	// finalize the min/max aggregates
 	vector<LogicalType> min_max_types;
 	for (auto &aggr_expr : min_max_aggregates) {
@@ -591,6 +729,10 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 			// min = max - generate an equality filter
 			auto constant_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min_val));
 			dynamic_filters->PushFilter(op, filter_col_idx, std::move(constant_filter));
+		} else if (!in_filter_keys.empty()) {
+			// few keys - generate an IN filter, which can also skip segments in between the keys
+			auto in_filter = make_uniq<InFilter>(std::move(in_filter_keys[filter_idx]));
+			dynamic_filters->PushFilter(op, filter_col_idx, std::move(in_filter));
 		} else {
 			// min != max - generate a range filter
 			auto greater_equals =
@@ -604,6 +746,33 @@ void JoinFilterPushdownInfo::PushFilters(JoinFilterGlobalState &gstate, const Ph
 	}
 }
 
+void JoinFilterPushdownInfo::InitializeBloomFilter(ClientContext &context, JoinFilterGlobalState &gstate,
+                                                   JoinHashTable &ht) const {
+	if (ht.Count() <= ClientConfig::GetConfig(context).dynamic_in_filter_threshold) {
+		// we push the exact keys as an IN filter already
+		return;
+	}
+	// the hashes stored in the hash table are computed over all equality conditions
+	// we can only re-use them for a bloom filter if we push a filter on the single equality condition
+	if (filters.size() != 1 || filters[0].join_condition != 0 || ht.equality_types.size() != 1) {
+		return;
+	}
+	if (ht.Count() > BloomFilter::MAX_KEY_COUNT) {
+		// the build side is too large for the bloom filter to be effective
+		return;
+	}
+	gstate.bloom_filter = make_uniq<BloomFilter>(ht.Count());
+	ht.bloom_filter = gstate.bloom_filter.get();
+}
+
+void JoinFilterPushdownInfo::PushBloomFilter(JoinFilterGlobalState &gstate, JoinHashTable &ht,
+                                             const PhysicalOperator &op) const {
+	D_ASSERT(gstate.bloom_filter);
+	ht.bloom_filter = nullptr;
+	auto filter_col_idx = filters[0].probe_column_index.column_index;
+	dynamic_filters->PushFilter(op, filter_col_idx, std::move(gstate.bloom_filter));
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
@@ -625,14 +794,14 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 			event.InsertEvent(std::move(new_event));
 		} else {
 			// No repartitioning! We do need some space for partitioning the probe-side, though
-			const auto probe_side_requirement =
+			sink.probe_side_requirement =
 			    GetPartitioningSpaceRequirement(context, children[0]->types, ht.GetRadixBits(), sink.num_threads);
-			sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size + probe_side_requirement);
+			sink.temporary_memory_state->SetMinimumReservation(max_partition_ht_size + sink.probe_side_requirement);
 			for (auto &local_ht : sink.local_hash_tables) {
 				ht.Merge(*local_ht);
 			}
 			sink.local_hash_tables.clear();
-			sink.hash_table->PrepareExternalFinalize(sink.temporary_memory_state->GetReservation());
+			sink.hash_table->PrepareExternalFinalize(sink.GetMaxHTSize());
 			sink.ScheduleFinalize(pipeline, event);
 		}
 		sink.finalized = true;
@@ -647,7 +816,8 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	ht.Unpartition();
 
 	if (filter_pushdown && ht.Count() > 0) {
-		filter_pushdown->PushFilters(*sink.global_filter_state, *this);
+		filter_pushdown->PushFilters(context, ht, *sink.global_filter_state, *this);
+		filter_pushdown->InitializeBloomFilter(context, *sink.global_filter_state, ht);
 	}
 
 	// check for possible perfect hash table
@@ -659,8 +829,13 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	}
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
+		// the bloom filter (if any) is filled while building the pointer table, and pushed once that is done
 		sink.perfect_join_executor.reset();
 		sink.ScheduleFinalize(pipeline, event);
+	} else if (filter_pushdown && sink.global_filter_state->bloom_filter) {
+		// perfect hash join: we don't build the pointer table, fill the bloom filter directly
+		ht.FillBloomFilter();
+		filter_pushdown->PushBloomFilter(*sink.global_filter_state, ht, *this);
 	}
 	sink.finalized = true;
 	if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
@@ -954,7 +1129,7 @@ void HashJoinGlobalSourceState::PrepareBuild(HashJoinGlobalSinkState &sink) {
 	sink.temporary_memory_state->UpdateReservation(sink.context);
 
 	// Try to put the next partitions in the block collection of the HT
-	if (!sink.external || !ht.PrepareExternalFinalize(sink.temporary_memory_state->GetReservation())) {
+	if (!sink.external || !ht.PrepareExternalFinalize(sink.GetMaxHTSize())) {
 		global_stage = HashJoinSourceStage::DONE;
 		sink.temporary_memory_state->SetRemainingSize(0);
 		sink.temporary_memory_state->UpdateReservation(sink.context);
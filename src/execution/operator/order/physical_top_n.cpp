@@ -6,6 +6,7 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +85,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to limit + offset entries (if it has grown large enough), returns true if it was reduced
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +277,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +308,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -424,6 +427,10 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		// the filter might have been set by a previous execution of this operator (e.g. in a recursive CTE)
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
@@ -434,10 +441,35 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce()) {
+		UpdateDynamicFilter(sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalTopN::UpdateDynamicFilter(TopNHeap &heap) const {
+	if (!dynamic_filter || !heap.has_boundary_values) {
+		return;
+	}
+	// every heap holds limit + offset rows that beat its boundary - so the boundary of any heap is a valid bound
+	auto boundary_value = heap.boundary_values.GetValue(0, 0);
+	if (boundary_value.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> l(dynamic_filter->lock);
+	auto &current_value = dynamic_filter->filter->constant;
+	if (dynamic_filter->initialized) {
+		// only update the filter if the new boundary is more selective than the current one
+		bool more_selective = orders[0].type == OrderType::ASCENDING ? boundary_value < current_value
+		                                                               : boundary_value > current_value;
+		if (!more_selective) {
+			return;
+		}
+	}
+	current_value = std::move(boundary_value);
+	dynamic_filter->initialized = true;
+}
+
 //===--------------------------------------------------------------------===//
 // Combine
 //===--------------------------------------------------------------------===//
@@ -448,6 +480,7 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 	// scan the local top N and append it to the global heap
 	lock_guard<mutex> glock(gstate.lock);
 	gstate.heap.Combine(lstate.heap);
+	UpdateDynamicFilter(gstate.heap);
 
 	return SinkCombineResultType::FINISHED;
 }
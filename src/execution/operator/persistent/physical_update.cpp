@@ -114,19 +114,22 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 		// figure out which rows have not yet been deleted in this update
 		// this is required since we might see the same row_id multiple times
 		// in the case of an UPDATE query that e.g. has joins
-		auto row_id_data = FlatVector::GetData<row_t>(row_ids);
-		SelectionVector sel(STANDARD_VECTOR_SIZE);
-		idx_t update_count = 0;
-		for (idx_t i = 0; i < update_chunk.size(); i++) {
-			auto row_id = row_id_data[i];
-			if (gstate.updated_columns.find(row_id) == gstate.updated_columns.end()) {
-				gstate.updated_columns.insert(row_id);
-				sel.set_index(update_count++, i);
+		// when the update rewrites the entire table every row id is seen exactly once, and we can skip this
+		if (!update_rewrites_table) {
+			auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+			SelectionVector sel(STANDARD_VECTOR_SIZE);
+			idx_t update_count = 0;
+			for (idx_t i = 0; i < update_chunk.size(); i++) {
+				auto row_id = row_id_data[i];
+				if (gstate.updated_columns.find(row_id) == gstate.updated_columns.end()) {
+					gstate.updated_columns.insert(row_id);
+					sel.set_index(update_count++, i);
+				}
+			}
+			if (update_count != update_chunk.size()) {
+				// we need to slice here
+				update_chunk.Slice(sel, update_count);
 			}
-		}
-		if (update_count != update_chunk.size()) {
-			// we need to slice here
-			update_chunk.Slice(sel, update_count);
 		}
 		auto &delete_state = lstate.GetDeleteState(table, tableref, context.client);
 		table.Delete(delete_state, context.client, row_ids, update_chunk.size());
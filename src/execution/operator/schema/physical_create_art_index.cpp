@@ -46,6 +46,10 @@ public:
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! The keys and row IDs of the current sorted run, which are bulk-loaded into the local index at once
+	vector<ARTKey> run_keys;
+	vector<row_t> run_row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -97,17 +101,20 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, Ope
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
-SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
+void PhysicalCreateARTIndex::BulkLoadSortedRun(CreateARTIndexLocalSinkState &l_state) const {
+	if (l_state.run_keys.empty()) {
+		return;
+	}
 
-	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 	auto &storage = table.GetStorage();
 	auto &l_index = l_state.local_index;
 
-	// create an ART from the chunk
+	// construct an ART bottom-up from the sorted run, its nodes are allocated densely in the local allocators
 	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
 	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
 	                          l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
+	Vector row_identifiers(LogicalType::ROW_TYPE, data_ptr_cast(l_state.run_row_ids.data()));
+	if (!art->ConstructFromSorted(l_state.run_keys.size(), l_state.run_keys, row_identifiers)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
@@ -116,6 +123,33 @@ SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, Opera
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
 	}
 
+	l_state.run_keys.clear();
+	l_state.run_row_ids.clear();
+	l_state.arena_allocator.Reset();
+}
+
+SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
+
+	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto count = l_state.key_chunk.size();
+
+	// the chunk is sorted, but a thread does not necessarily receive consecutive chunks of the sorted data:
+	// a chunk that does not continue the current run (or exceeds its capacity) starts a new run
+	auto &run_keys = l_state.run_keys;
+	if (!run_keys.empty() && (run_keys.back() > l_state.keys[0] || run_keys.size() + count > SORTED_RUN_CAPACITY)) {
+		BulkLoadSortedRun(l_state);
+		ART::GenerateKeys<true>(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
+	}
+
+	UnifiedVectorFormat row_id_data;
+	row_identifiers.ToUnifiedFormat(count, row_id_data);
+	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+
+	for (idx_t i = 0; i < count; i++) {
+		run_keys.push_back(l_state.keys[i]);
+		l_state.run_row_ids.push_back(row_ids[row_id_data.sel->get_index(i)]);
+	}
+
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -125,15 +159,16 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 	D_ASSERT(chunk.ColumnCount() >= 2);
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	l_state.arena_allocator.Reset();
 
 	// Insert the keys and their corresponding row identifiers.
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
 	if (sorted) {
+		// the keys of the current sorted run must stay alive until it is bulk-loaded
 		ART::GenerateKeys<true>(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
 		return SinkSorted(row_identifiers, input);
 	}
 
+	l_state.arena_allocator.Reset();
 	ART::GenerateKeys(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
 	return SinkUnsorted(row_identifiers, input);
 }
@@ -143,6 +178,9 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	if (sorted) {
+		BulkLoadSortedRun(l_state);
+	}
 
 	// merge the local index into the global index
 	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
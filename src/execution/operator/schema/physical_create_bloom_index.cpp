@@ -0,0 +1,115 @@
+#include "duckdb/execution/operator/schema/physical_create_bloom_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+
+namespace duckdb {
+
+PhysicalCreateBloomIndex::PhysicalCreateBloomIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                   const vector<column_t> &column_ids,
+                                                   unique_ptr<CreateIndexInfo> info,
+                                                   vector<unique_ptr<Expression>> unbound_expressions,
+                                                   idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
+
+	// convert virtual column ids to storage column ids
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+
+class CreateBloomIndexGlobalSinkState : public GlobalSinkState {
+public:
+	//! Global index to be added to the table
+	unique_ptr<BoundIndex> global_index;
+};
+
+class CreateBloomIndexLocalSinkState : public LocalSinkState {
+public:
+	CreateBloomIndexLocalSinkState() : hashes(LogicalType::HASH) {
+	}
+
+	//! The hashes of the keys, which are computed before locking the global index
+	Vector hashes;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCreateBloomIndex::GetGlobalSinkState(ClientContext &context) const {
+	auto state = make_uniq<CreateBloomIndexGlobalSinkState>();
+
+	// create the global index
+	auto &storage = table.GetStorage();
+	state->global_index = make_uniq<BloomIndex>(info->index_name, info->constraint_type, storage_ids,
+	                                            TableIOManager::Get(storage), unbound_expressions, storage.db);
+	return std::move(state);
+}
+
+unique_ptr<LocalSinkState> PhysicalCreateBloomIndex::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<CreateBloomIndexLocalSinkState>();
+}
+
+SinkResultType PhysicalCreateBloomIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                              OperatorSinkInput &input) const {
+
+	D_ASSERT(chunk.ColumnCount() == 2);
+	auto &g_state = input.global_state.Cast<CreateBloomIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateBloomIndexLocalSinkState>();
+
+	// setting the bits is cheap compared to hashing, so all threads insert directly into the global index
+	VectorOperations::Hash(chunk.data[0], l_state.hashes, chunk.size());
+
+	auto &index = g_state.global_index->Cast<BloomIndex>();
+	IndexLock lock;
+	index.InitializeLock(lock);
+	index.InsertHashes(lock, chunk.data[0], l_state.hashes, chunk.data[1], chunk.size());
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkFinalizeType PhysicalCreateBloomIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                    OperatorSinkFinalizeInput &input) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = input.global_state.Cast<CreateBloomIndexGlobalSinkState>();
+
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context), *info, table).get();
+	if (!index_entry) {
+		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
+		// index already exists, but error ignored because of IF NOT EXISTS
+		return SinkFinalizeType::READY;
+	}
+	auto &index = index_entry->Cast<DuckIndexEntry>();
+	index.initial_index_size = state.global_index->GetInMemorySize();
+
+	// add index to storage
+	storage.AddIndex(std::move(state.global_index));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+
+SourceResultType PhysicalCreateBloomIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                   OperatorSourceInput &input) const {
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
@@ -1,14 +1,18 @@
 #include "duckdb/catalog/catalog_entry/aggregate_function_catalog_entry.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/function_binder.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
 
@@ -149,6 +153,86 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Returns the column a projected expression reads, if the expression keeps equal values adjacent (and distinct
+//! values apart), i.e., if it is a plain reference or the lossless (de)compression of compressed materialization
+static optional_ptr<BoundReferenceExpression> GetAdjacencyPreservingReference(Expression &expr) {
+	if (expr.GetExpressionType() == ExpressionType::BOUND_REF) {
+		return &expr.Cast<BoundReferenceExpression>();
+	}
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return nullptr;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	const auto &name = func.function.name;
+	const auto compression =
+	    StringUtil::StartsWith(name, "__internal_compress") || StringUtil::StartsWith(name, "__internal_decompress");
+	if (!compression) {
+		return nullptr;
+	}
+	if (func.children.empty() || func.children[0]->GetExpressionType() != ExpressionType::BOUND_REF) {
+		return nullptr;
+	}
+	return &func.children[0]->Cast<BoundReferenceExpression>();
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op, PhysicalOperator &child) {
+	if (op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	if (!PhysicalStreamingAggregate::CanStreamAggregates(op.expressions)) {
+		return false;
+	}
+	// The group columns, in terms of the output of the operator we are currently looking at
+	vector<idx_t> group_columns;
+	for (auto &group : op.groups) {
+		if (group->GetExpressionType() != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		group_columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	// Walk down through operators that preserve the order of their input until we find where the order comes from
+	reference<PhysicalOperator> current = child;
+	while (true) {
+		switch (current.get().type) {
+		case PhysicalOperatorType::PROJECTION: {
+			auto &projection = current.get().Cast<PhysicalProjection>();
+			for (auto &column : group_columns) {
+				auto ref = GetAdjacencyPreservingReference(*projection.select_list[column]);
+				if (!ref) {
+					return false;
+				}
+				column = ref->index;
+			}
+			break;
+		}
+		case PhysicalOperatorType::FILTER:
+			break;
+		case PhysicalOperatorType::ORDER_BY: {
+			// All rows of a group are adjacent if the groups are (a permutation of) a prefix of the sort keys
+			auto &order = current.get().Cast<PhysicalOrder>();
+			unordered_set<idx_t> remaining;
+			for (auto &column : group_columns) {
+				remaining.insert(order.projections[column]);
+			}
+			for (auto &order_node : order.orders) {
+				if (remaining.empty()) {
+					break;
+				}
+				auto &expr = *order_node.expression;
+				if (expr.GetExpressionType() != ExpressionType::BOUND_REF ||
+				    remaining.erase(expr.Cast<BoundReferenceExpression>().index) == 0) {
+					return false;
+				}
+			}
+			return remaining.empty();
+		}
+		default:
+			return false;
+		}
+		current = *current.get().children[0];
+	}
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
@@ -184,6 +268,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
+		} else if (CanUseStreamingAggregate(op, *plan)) {
+			// the input is ordered on the groups: aggregate one group at a time instead of building a hash table
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
 		} else {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.grouping_sets),
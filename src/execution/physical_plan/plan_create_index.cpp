@@ -3,6 +3,7 @@
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/schema/physical_create_art_index.hpp"
+#include "duckdb/execution/operator/schema/physical_create_bloom_index.hpp"
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_create_index.hpp"
@@ -30,12 +31,22 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 		}
 	}
 
-	// if we get here and the index type is not ART, we throw an exception
-	// because we don't support any other index type yet. However, an operator extension could have
-	// replaced this part of the plan with a different index creation operator.
-	if (op.info->index_type != ART::TYPE_NAME) {
+	// if we get here and the index type is not a built-in index type, we throw an exception.
+	// However, an operator extension could have replaced this part of the plan with a different
+	// index creation operator.
+	auto is_bloom_index = op.info->index_type == BloomIndex::TYPE_NAME;
+	if (op.info->index_type != ART::TYPE_NAME && !is_bloom_index) {
 		throw BinderException("Unknown index type: " + op.info->index_type);
 	}
+	if (is_bloom_index) {
+		if (op.info->constraint_type != IndexConstraintType::NONE) {
+			throw BinderException("BLOOM indexes do not support UNIQUE or PRIMARY KEY constraints");
+		}
+		if (op.unbound_expressions.size() != 1 ||
+		    op.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			throw BinderException("BLOOM indexes can only be created on a single column");
+		}
+	}
 
 	// table scan operator for index key columns and row IDs
 	dependencies.AddDependency(op.table);
@@ -76,6 +87,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	null_filter->types.emplace_back(LogicalType::ROW_TYPE);
 	null_filter->children.push_back(std::move(projection));
 
+	if (is_bloom_index) {
+		// the bloom filters are order-independent, so the keys are inserted as they are scanned
+		auto physical_create_index =
+		    make_uniq<PhysicalCreateBloomIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                        std::move(op.unbound_expressions), op.estimated_cardinality);
+		physical_create_index->children.push_back(std::move(null_filter));
+		return std::move(physical_create_index);
+	}
+
 	// determine if we sort the data prior to index creation
 	// we don't sort, if either VARCHAR or compound key
 	auto perform_sorting = true;
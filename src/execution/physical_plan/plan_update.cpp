@@ -13,6 +13,7 @@ unique_ptr<PhysicalOperator> DuckCatalog::PlanUpdate(ClientContext &context, Log
 	                                        std::move(op.bound_constraints), op.estimated_cardinality, op.return_chunk);
 
 	update->update_is_del_and_insert = op.update_is_del_and_insert;
+	update->update_rewrites_table = op.update_rewrites_table;
 	update->children.push_back(std::move(plan));
 	return std::move(update);
 }
@@ -142,6 +142,10 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! How many rows a thread must have sunk before we consider skipping the HT lookups
+	static constexpr const idx_t SKIP_LOOKUP_THRESHOLD = 262144;
+	//! If more than this fraction of the sunk rows end up as groups, pre-aggregation is not worth the lookups
+	static constexpr const double UNIQUE_PERCENTAGE_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -333,6 +337,9 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Number of rows sunk into the HT, and number of groups created for them before the last reset
+	idx_t sink_count = 0;
+	idx_t materialized_count = 0;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
@@ -457,6 +464,7 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += group_chunk.size();
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
@@ -465,9 +473,20 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
-		ht.ClearPointerTable();
+		lstate.materialized_count += ht.Count();
+		if (!ht.SkipsLookups()) {
+			ht.ClearPointerTable();
+		}
 		ht.ResetCount();
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
+
+		// The partitions are aggregated again during Finalize anyway, so if the thread-local HT barely reduces the
+		// data (i.e., the groups are (nearly) unique), we stop looking up the groups and just append the rows
+		if (!ht.SkipsLookups() && lstate.sink_count >= RadixHTConfig::SKIP_LOOKUP_THRESHOLD &&
+		    static_cast<double>(lstate.materialized_count) >
+		        RadixHTConfig::UNIQUE_PERCENTAGE_THRESHOLD * static_cast<double>(lstate.sink_count)) {
+			ht.SkipLookups();
+		}
 	}
 
 	// Check if we need to repartition
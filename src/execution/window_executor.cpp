@@ -4,6 +4,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
 
 namespace duckdb {
 
@@ -925,6 +926,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsSlidingAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
 	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
@@ -1023,6 +1025,60 @@ bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	return (mode < WindowAggregationMode::COMBINE);
 }
 
+static bool GetSlidingOffset(WindowBoundary boundary, const unique_ptr<Expression> &expr, int64_t &offset) {
+	switch (boundary) {
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		offset = 0;
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		break;
+	default:
+		return false;
+	}
+
+	if (!expr || expr->GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return false;
+	}
+	auto value = expr->Cast<BoundConstantExpression>().value;
+	if (value.IsNull() || !value.DefaultTryCastAs(LogicalType::BIGINT)) {
+		return false;
+	}
+	offset = value.GetValue<int64_t>();
+	if (offset < 0 || offset > int64_t(WindowSlidingAggregator::MAX_FRAME_WIDTH)) {
+		return false;
+	}
+	if (boundary == WindowBoundary::EXPR_PRECEDING_ROWS) {
+		offset = -offset;
+	}
+	return true;
+}
+
+bool WindowAggregateExecutorGlobalState::IsSlidingAggregate() {
+	const auto &wexpr = executor.wexpr;
+	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
+
+	if (!wexpr.aggregate || mode != WindowAggregationMode::WINDOW) {
+		return false;
+	}
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	ROWS frames with constant offsets slide forward through the partition
+	int64_t begin_offset;
+	int64_t end_offset;
+	if (!GetSlidingOffset(wexpr.start, wexpr.start_expr, begin_offset) ||
+	    !GetSlidingOffset(wexpr.end, wexpr.end_expr, end_offset)) {
+		return false;
+	}
+	if (end_offset < begin_offset || end_offset - begin_offset >= int64_t(WindowSlidingAggregator::MAX_FRAME_WIDTH)) {
+		return false;
+	}
+
+	return WindowSlidingAggregator::CanAggregate(AggregateObject(wexpr), arg_types, wexpr.return_type);
+}
+
 void WindowExecutor::Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorLocalState &lstate,
                               WindowExecutorGlobalState &gstate) const {
 	auto &lbstate = lstate.Cast<WindowExecutorBoundsState>();
@@ -1063,6 +1119,9 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (IsSlidingAggregate()) {
+		// slide the frames through the partition without building a tree
+		aggregator = make_uniq<WindowSlidingAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
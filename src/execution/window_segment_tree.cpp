@@ -1342,6 +1342,443 @@ void WindowSegmentTreePart::EvaluateLeaves(const WindowSegmentTreeGlobalState &t
 	FlushStates(false);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+static WindowSlidingAggregator::InverseType GetInverseType(const AggregateObject &aggr,
+                                                           const vector<LogicalType> &arg_types,
+                                                           const LogicalType &result_type) {
+	using InverseType = WindowSlidingAggregator::InverseType;
+
+	//	Bound variants (e.g., DECIMAL) have their own finalisation
+	if (aggr.GetFunctionData()) {
+		return InverseType::NONE;
+	}
+
+	const auto &name = aggr.function.name;
+	if (name == "count_star" || name == "count") {
+		if (arg_types.size() > 1 || result_type.id() != LogicalTypeId::BIGINT) {
+			return InverseType::NONE;
+		}
+		return InverseType::COUNT;
+	}
+
+	if (arg_types.size() != 1) {
+		return InverseType::NONE;
+	}
+	const auto arg_type = arg_types[0].id();
+	switch (arg_type) {
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+		break;
+	default:
+		return InverseType::NONE;
+	}
+	if ((name == "sum" || name == "sum_no_overflow") && result_type.id() == LogicalTypeId::HUGEINT) {
+		return InverseType::SUM;
+	}
+	if (name == "avg" && result_type.id() == LogicalTypeId::DOUBLE) {
+		//	Mirror the state types of the integer averages
+		return arg_type == LogicalTypeId::SMALLINT ? InverseType::AVERAGE : InverseType::AVERAGE_HUGEINT;
+	}
+
+	return InverseType::NONE;
+}
+
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                                 const LogicalType &result_type,
+                                                 const WindowExcludeMode exclude_mode_p)
+    : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode_p),
+      inverse(GetInverseType(this->aggr, arg_types, result_type)) {
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+bool WindowSlidingAggregator::CanAggregate(const AggregateObject &aggr, const vector<LogicalType> &arg_types,
+                                           const LogicalType &result_type) {
+	if (aggr.IsDistinct()) {
+		return false;
+	}
+
+	if (GetInverseType(aggr, arg_types, result_type) != InverseType::NONE) {
+		return true;
+	}
+
+	//	The stacks combine the two halves of a frame out of order
+	return aggr.function.combine && aggr.function.order_dependent == AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+}
+
+class WindowSlidingState : public WindowAggregatorState {
+public:
+	explicit WindowSlidingState(const WindowSlidingAggregator &aggregator);
+
+	void Evaluate(const WindowAggregatorGlobalState &gsink, const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Evaluates invertible aggregates by adding the entering rows and subtracting the evicted rows
+	void EvaluateRunning(const WindowAggregatorGlobalState &gsink, const idx_t *begins, const idx_t *ends,
+	                     Vector &result, idx_t count);
+	//! Adds the rows [begin, end) to the running total, or subtracts them
+	void UpdateRunning(const WindowAggregatorGlobalState &gsink, idx_t begin, idx_t end, bool subtract);
+	//! Evaluates the rows [rid_begin, rid_end) whose frames contain the pivot, using a front stack of suffix states
+	//! over [lo, pivot) and a back stack of prefix states over [pivot, hi)
+	void EvaluateStacks(const WindowAggregatorGlobalState &gsink, const idx_t *begins, const idx_t *ends,
+	                    idx_t rid_begin, idx_t rid_end, idx_t lo, idx_t pivot, idx_t hi);
+	//! Flush the buffered input rows into the stacked states
+	void FlushUpdates(const WindowAggregatorGlobalState &gsink);
+	//! Flush the buffered stacked states into the result states
+	void FlushCombines();
+	//! Combine a single state into another one
+	void CombineState(data_ptr_t source, data_ptr_t target);
+
+	//! The aggregator
+	const WindowSlidingAggregator &aggregator;
+	//! Data pointer that contains a vector of states, used for the results
+	vector<data_t> state;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! The states of the front and back stacks
+	vector<data_t> stacks;
+	//! A vector of pointers to the states being updated or combined into
+	Vector statep;
+	//! A vector of pointers to the states being combined
+	Vector statel;
+	//! Input data chunk, used for updating the stacks
+	DataChunk leaves;
+	//! The rows being updated
+	SelectionVector update_sel;
+	//! Count of buffered values
+	idx_t flush_count;
+	//! The single source state for chaining the stacks
+	data_ptr_t source_ptr;
+	Vector source;
+	//! The single target state for chaining the stacks
+	data_ptr_t target_ptr;
+	Vector target;
+	//! The running total of invertible aggregates over [running_begin, running_end)
+	hugeint_t running_sum;
+	idx_t running_count;
+	idx_t running_begin;
+	idx_t running_end;
+};
+
+WindowSlidingState::WindowSlidingState(const WindowSlidingAggregator &aggregator_p)
+    : aggregator(aggregator_p), state(aggregator.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER),
+      statep(LogicalType::POINTER), statel(LogicalType::POINTER), flush_count(0), source_ptr(nullptr),
+      source(LogicalType::POINTER, data_ptr_cast(&source_ptr)), target_ptr(nullptr),
+      target(LogicalType::POINTER, data_ptr_cast(&target_ptr)), running_sum(0), running_count(0), running_begin(0),
+      running_end(0) {
+	update_sel.Initialize();
+
+	//	Build the finalise vector that just points to the result states
+	data_ptr_t state_ptr = state.data();
+	D_ASSERT(statef.GetVectorType() == VectorType::FLAT_VECTOR);
+	statef.SetVectorType(VectorType::CONSTANT_VECTOR);
+	statef.Flatten(STANDARD_VECTOR_SIZE);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += aggregator.state_size;
+	}
+}
+
+void WindowSlidingState::FlushUpdates(const WindowAggregatorGlobalState &gsink) {
+	if (!flush_count) {
+		return;
+	}
+
+	auto &aggr = aggregator.aggr;
+	leaves.Slice(gsink.inputs, update_sel, flush_count);
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), statep, flush_count);
+
+	flush_count = 0;
+}
+
+void WindowSlidingState::FlushCombines() {
+	if (!flush_count) {
+		return;
+	}
+
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(statel, statep, aggr_input_data, flush_count);
+
+	flush_count = 0;
+}
+
+void WindowSlidingState::CombineState(data_ptr_t source_state, data_ptr_t target_state) {
+	auto &aggr = aggregator.aggr;
+	source_ptr = source_state;
+	target_ptr = target_state;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(source, target, aggr_input_data, 1);
+}
+
+template <class INPUT_TYPE, class SUM_TYPE>
+static void SlidingAccumulate(const Vector &input, const ValidityArray &filter_mask, idx_t begin, idx_t end,
+                              hugeint_t &sum, idx_t &count) {
+	auto data = FlatVector::GetData<const INPUT_TYPE>(input);
+	auto &validity = FlatVector::Validity(input);
+	SUM_TYPE total = 0;
+	for (auto i = begin; i < end; ++i) {
+		if (filter_mask.RowIsValid(i) && validity.RowIsValid(i)) {
+			total += SUM_TYPE(data[i]);
+			++count;
+		}
+	}
+	sum = hugeint_t(total);
+}
+
+void WindowSlidingState::UpdateRunning(const WindowAggregatorGlobalState &gsink, idx_t begin, idx_t end,
+                                       bool subtract) {
+	auto &filter_mask = gsink.filter_mask;
+	auto &inputs = gsink.inputs;
+
+	hugeint_t sum = 0;
+	idx_t count = 0;
+	if (aggregator.inverse == WindowSlidingAggregator::InverseType::COUNT) {
+		//	COUNT(*) has no input to check for NULLs
+		for (auto i = begin; i < end; ++i) {
+			if (!filter_mask.RowIsValid(i)) {
+				continue;
+			}
+			if (inputs.ColumnCount() && !FlatVector::Validity(inputs.data[0]).RowIsValid(i)) {
+				continue;
+			}
+			++count;
+		}
+	} else {
+		auto &input = inputs.data[0];
+		switch (input.GetType().InternalType()) {
+		case PhysicalType::INT16:
+			SlidingAccumulate<int16_t, int64_t>(input, filter_mask, begin, end, sum, count);
+			break;
+		case PhysicalType::INT32:
+			SlidingAccumulate<int32_t, int64_t>(input, filter_mask, begin, end, sum, count);
+			break;
+		case PhysicalType::INT64:
+			SlidingAccumulate<int64_t, hugeint_t>(input, filter_mask, begin, end, sum, count);
+			break;
+		default:
+			throw InternalException("Unsupported type for sliding window aggregate");
+		}
+	}
+
+	if (subtract) {
+		running_sum -= sum;
+		running_count -= count;
+	} else {
+		running_sum += sum;
+		running_count += count;
+	}
+}
+
+void WindowSlidingState::EvaluateRunning(const WindowAggregatorGlobalState &gsink, const idx_t *begins,
+                                         const idx_t *ends, Vector &result, idx_t count) {
+	using InverseType = WindowSlidingAggregator::InverseType;
+
+	for (idx_t rid = 0; rid < count; ++rid) {
+		const auto begin = begins[rid];
+		const auto end = ends[rid];
+
+		//	Start over when the frame is empty, moves backwards (e.g., a new partition) or skips past the total
+		if (end <= begin || begin < running_begin || end < running_end || begin >= running_end) {
+			running_sum = 0;
+			running_count = 0;
+			running_begin = running_end = begin;
+		}
+		if (end > running_end) {
+			UpdateRunning(gsink, running_end, end, false);
+			running_end = end;
+		}
+		if (begin > running_begin) {
+			UpdateRunning(gsink, running_begin, begin, true);
+			running_begin = begin;
+		}
+
+		switch (aggregator.inverse) {
+		case InverseType::COUNT:
+			FlatVector::GetData<int64_t>(result)[rid] = UnsafeNumericCast<int64_t>(running_count);
+			break;
+		case InverseType::SUM:
+			if (!running_count) {
+				FlatVector::SetNull(result, rid, true);
+			} else {
+				FlatVector::GetData<hugeint_t>(result)[rid] = running_sum;
+			}
+			break;
+		case InverseType::AVERAGE:
+			if (!running_count) {
+				FlatVector::SetNull(result, rid, true);
+			} else {
+				const auto divident = double(running_count);
+				FlatVector::GetData<double>(result)[rid] = double(Hugeint::Cast<int64_t>(running_sum)) / divident;
+			}
+			break;
+		case InverseType::AVERAGE_HUGEINT:
+			if (!running_count) {
+				FlatVector::SetNull(result, rid, true);
+			} else {
+				const auto divident = static_cast<long double>(running_count);
+				FlatVector::GetData<double>(result)[rid] =
+				    static_cast<double>(Hugeint::Cast<long double>(running_sum) / divident);
+			}
+			break;
+		default:
+			throw InternalException("Unsupported sliding window total");
+		}
+	}
+}
+
+void WindowSlidingState::EvaluateStacks(const WindowAggregatorGlobalState &gsink, const idx_t *begins,
+                                        const idx_t *ends, idx_t rid_begin, idx_t rid_end, idx_t lo, idx_t pivot,
+                                        idx_t hi) {
+	auto &aggr = aggregator.aggr;
+	auto &filter_mask = gsink.filter_mask;
+	const auto state_size = aggregator.state_size;
+
+	//	Every row in [lo, hi) gets a state: the front stack holds the suffix aggregates of [lo, pivot)
+	//	and the back stack holds the prefix aggregates of [pivot, hi).
+	if (stacks.size() < (hi - lo) * state_size) {
+		stacks.resize((hi - lo) * state_size);
+	}
+	auto leaf = [&](idx_t f) {
+		return stacks.data() + (f - lo) * state_size;
+	};
+
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+	for (auto f = lo; f < hi; ++f) {
+		auto leaf_state = leaf(f);
+		aggr.function.initialize(leaf_state);
+		if (filter_mask.RowIsValid(f)) {
+			pdata[flush_count] = leaf_state;
+			update_sel.set_index(flush_count++, f);
+			if (flush_count >= STANDARD_VECTOR_SIZE) {
+				FlushUpdates(gsink);
+			}
+		}
+	}
+	FlushUpdates(gsink);
+
+	for (auto f = pivot - 1; f > lo; --f) {
+		CombineState(leaf(f), leaf(f - 1));
+	}
+	for (auto f = pivot + 1; f < hi; ++f) {
+		CombineState(leaf(f - 1), leaf(f));
+	}
+
+	//	Each frame combines one state from each stack
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	for (auto rid = rid_begin; rid < rid_end; ++rid) {
+		if (begins[rid] >= ends[rid]) {
+			continue;
+		}
+		if (begins[rid] < pivot) {
+			ldata[flush_count] = leaf(begins[rid]);
+			pdata[flush_count++] = fdata[rid];
+		}
+		if (ends[rid] > pivot) {
+			ldata[flush_count] = leaf(ends[rid] - 1);
+			pdata[flush_count++] = fdata[rid];
+		}
+		if (flush_count >= STANDARD_VECTOR_SIZE - 1) {
+			FlushCombines();
+		}
+	}
+	FlushCombines();
+
+	//	Destruct the stacked states
+	if (aggr.function.destructor) {
+		AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+		for (auto f = lo; f < hi; ++f) {
+			pdata[flush_count++] = leaf(f);
+			if (flush_count >= STANDARD_VECTOR_SIZE) {
+				aggr.function.destructor(statep, aggr_input_data, flush_count);
+				flush_count = 0;
+			}
+		}
+		if (flush_count) {
+			aggr.function.destructor(statep, aggr_input_data, flush_count);
+			flush_count = 0;
+		}
+	}
+}
+
+void WindowSlidingState::Evaluate(const WindowAggregatorGlobalState &gsink, const DataChunk &bounds, Vector &result,
+                                  idx_t count) {
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+
+	if (aggregator.inverse != WindowSlidingAggregator::InverseType::NONE) {
+		EvaluateRunning(gsink, begins, ends, result, count);
+		return;
+	}
+
+	auto &aggr = aggregator.aggr;
+	auto &inputs = gsink.inputs;
+	if (leaves.ColumnCount() == 0 && inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+
+	//	The previous results have been finalised, so the stacks can reuse the arena
+	allocator.Reset();
+
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t rid = 0; rid < count; ++rid) {
+		aggr.function.initialize(fdata[rid]);
+	}
+
+	//	Rows share a pivot at the end of the first frame for as long as the frames
+	//	keep sliding forward and still contain the pivot
+	for (idx_t rid = 0; rid < count;) {
+		if (begins[rid] >= ends[rid]) {
+			++rid;
+			continue;
+		}
+		const auto lo = begins[rid];
+		const auto pivot = ends[rid];
+		auto prev_begin = lo;
+		auto prev_end = pivot;
+		auto next = rid + 1;
+		for (; next < count; ++next) {
+			if (begins[next] >= ends[next]) {
+				continue;
+			}
+			if (begins[next] < prev_begin || ends[next] < prev_end || begins[next] > pivot) {
+				break;
+			}
+			prev_begin = begins[next];
+			prev_end = ends[next];
+		}
+		EvaluateStacks(gsink, begins, ends, rid, next, lo, pivot, prev_end);
+		rid = next;
+	}
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+
+	//	Destruct the result aggregates
+	if (aggr.function.destructor) {
+		aggr.function.destructor(statef, aggr_input_data, count);
+	}
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState(const WindowAggregatorState &gstate) const {
+	return make_uniq<WindowSlidingState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                       const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &gasink = gsink.Cast<WindowAggregatorGlobalState>();
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Evaluate(gasink, bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowDistinctAggregator
 //===--------------------------------------------------------------------===//
@@ -19,6 +19,7 @@ static const DefaultCompressionMethod internal_compression_methods[] = {
     {CompressionType::COMPRESSION_UNCOMPRESSED, UncompressedFun::GetFunction, UncompressedFun::TypeIsSupported},
     {CompressionType::COMPRESSION_RLE, RLEFun::GetFunction, RLEFun::TypeIsSupported},
     {CompressionType::COMPRESSION_BITPACKING, BitpackingFun::GetFunction, BitpackingFun::TypeIsSupported},
+    {CompressionType::COMPRESSION_PFOR_DELTA, PForDeltaFun::GetFunction, PForDeltaFun::TypeIsSupported},
     {CompressionType::COMPRESSION_DICTIONARY, DictionaryCompressionFun::GetFunction,
      DictionaryCompressionFun::TypeIsSupported},
     {CompressionType::COMPRESSION_CHIMP, ChimpCompressionFun::GetFunction, ChimpCompressionFun::TypeIsSupported},
@@ -26,6 +27,7 @@ static const DefaultCompressionMethod internal_compression_methods[] = {
     {CompressionType::COMPRESSION_ALP, AlpCompressionFun::GetFunction, AlpCompressionFun::TypeIsSupported},
     {CompressionType::COMPRESSION_ALPRD, AlpRDCompressionFun::GetFunction, AlpRDCompressionFun::TypeIsSupported},
     {CompressionType::COMPRESSION_FSST, FSSTFun::GetFunction, FSSTFun::TypeIsSupported},
+    {CompressionType::COMPRESSION_ZSTD, ZSTDFun::GetFunction, ZSTDFun::TypeIsSupported},
     {CompressionType::COMPRESSION_AUTO, nullptr, nullptr}};
 
 static optional_ptr<CompressionFunction> FindCompressionFunction(CompressionFunctionSet &set, CompressionType type,
@@ -73,12 +75,14 @@ vector<reference<CompressionFunction>> DBConfig::GetCompressionFunctions(const P
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_UNCOMPRESSED, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_RLE, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_BITPACKING, physical_type);
+	TryLoadCompression(*this, result, CompressionType::COMPRESSION_PFOR_DELTA, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_DICTIONARY, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_CHIMP, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_PATAS, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_ALP, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_ALPRD, physical_type);
 	TryLoadCompression(*this, result, CompressionType::COMPRESSION_FSST, physical_type);
+	TryLoadCompression(*this, result, CompressionType::COMPRESSION_ZSTD, physical_type);
 	return result;
 }
 
@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/bloom/bloom_index.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -90,7 +91,12 @@ unique_ptr<GlobalTableFunctionState> TableScanInitGlobal(ClientContext &context,
 	D_ASSERT(input.bind_data);
 	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
 	auto result = make_uniq<TableScanGlobalState>(context, input.bind_data.get());
-	bind_data.table.GetStorage().InitializeParallelScan(context, result->state);
+	auto &storage = bind_data.table.GetStorage();
+	if (input.filters && !input.filters->filters.empty()) {
+		// bind any BLOOM indexes, so that the scan can use them to skip row groups
+		storage.GetDataTableInfo()->InitializeIndexes(context, BloomIndex::TYPE_NAME);
+	}
+	storage.InitializeParallelScan(context, result->state);
 	if (input.CanRemoveFilterColumns()) {
 		result->projection_ids = input.projection_ids;
 		const auto &columns = bind_data.table.GetColumns();
@@ -78,6 +78,8 @@ public:
 
 	//! Returns a list of the constraints of the table
 	DUCKDB_API const vector<unique_ptr<Constraint>> &GetConstraints() const;
+	//! Returns the columns the table is clustered on (if any)
+	DUCKDB_API const vector<string> &GetOrderBy() const;
 	DUCKDB_API string ToSQL() const override;
 
 	//! Get statistics of a column (physical or virtual) within the table
@@ -97,6 +99,8 @@ public:
 	}
 
 	DUCKDB_API static string ColumnsToSQL(const ColumnList &columns, const vector<unique_ptr<Constraint>> &constraints);
+	//! Returns the WITH clause that clusters the table on the given columns (or an empty string)
+	DUCKDB_API static string OrderByToSQL(const vector<string> &order_by);
 
 	//! Returns a list of segment information for this table, if exists
 	virtual vector<ColumnSegmentInfo> GetColumnSegmentInfo();
@@ -112,5 +116,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The columns the table is clustered on
+	vector<string> order_by;
 };
 } // namespace duckdb
@@ -322,6 +322,12 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TaskSchedulerMode : uint8_t;
+
+enum class TemporaryBufferCodec : uint8_t;
+
+enum class TemporaryFileCompression : uint8_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionModifierType : uint8_t;
@@ -788,6 +794,15 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TaskSchedulerMode>(TaskSchedulerMode value);
+
+template<>
+const char* EnumUtil::ToChars<TemporaryBufferCodec>(TemporaryBufferCodec value);
+
+template<>
+const char* EnumUtil::ToChars<TemporaryFileCompression>(TemporaryFileCompression value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -1269,6 +1284,15 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TaskSchedulerMode EnumUtil::FromString<TaskSchedulerMode>(const char *value);
+
+template<>
+TemporaryBufferCodec EnumUtil::FromString<TemporaryBufferCodec>(const char *value);
+
+template<>
+TemporaryFileCompression EnumUtil::FromString<TemporaryFileCompression>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
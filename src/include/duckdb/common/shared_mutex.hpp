@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/shared_mutex.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/typedefs.hpp"
+
+#include <condition_variable>
+
+namespace duckdb {
+
+//! A mutex that is either held exclusively by a single writer, or shared by any number of readers.
+//! Waiting writers take precedence over new readers, so that a steady stream of readers cannot starve them.
+//! lock() and unlock() satisfy the requirements of unique_lock (C++11 has no std::shared_mutex).
+class SharedMutex {
+public:
+	SharedMutex();
+
+	//! Obtain an exclusive lock
+	void lock(); // NOLINT: match the standard library
+	//! Release an exclusive lock
+	void unlock(); // NOLINT: match the standard library
+	//! Obtain a shared lock
+	void lock_shared(); // NOLINT: match the standard library
+	//! Release a shared lock
+	void unlock_shared(); // NOLINT: match the standard library
+
+private:
+	mutex internal_lock;
+	std::condition_variable readers_cv;
+	std::condition_variable writers_cv;
+	//! The number of readers that hold the lock
+	idx_t active_readers;
+	//! The number of writers that wait for the lock
+	idx_t waiting_writers;
+	//! Whether a writer holds the lock
+	bool active_writer;
+};
+
+//! Holds a shared lock on a SharedMutex for its lifetime
+class SharedLockGuard {
+public:
+	explicit SharedLockGuard(SharedMutex &shared_mutex) : shared_mutex(shared_mutex) {
+		shared_mutex.lock_shared();
+	}
+	~SharedLockGuard() {
+		shared_mutex.unlock_shared();
+	}
+
+	SharedLockGuard(const SharedLockGuard &) = delete;
+	SharedLockGuard &operator=(const SharedLockGuard &) = delete;
+
+private:
+	SharedMutex &shared_mutex;
+};
+
+} // namespace duckdb
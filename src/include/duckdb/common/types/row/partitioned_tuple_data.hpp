@@ -110,6 +110,10 @@ public:
 	void Reset();
 	//! Repartition this PartitionedTupleData into the new PartitionedTupleData
 	void Repartition(PartitionedTupleData &new_partitioned_data);
+	//! Repartition the partitions [partition_start, partition_end) of this PartitionedTupleData into the new
+	//! PartitionedTupleData (can be called concurrently for disjoint ranges)
+	void Repartition(PartitionedTupleData &new_partitioned_data, const idx_t partition_start,
+	                 const idx_t partition_end);
 	//! Unpins the data
 	void Unpin();
 	//! Get the partitions in this PartitionedTupleData
@@ -191,6 +195,9 @@ protected:
 			return make_uniq<TupleDataCollection>(buffer_manager, layout);
 		}
 	}
+	//! Repartition the partitions [partition_start, partition_end) into the new PartitionedTupleData
+	void RepartitionInternal(PartitionedTupleData &new_partitioned_data, const idx_t partition_start,
+	                         const idx_t partition_end);
 	//! Verify count/data size of this PartitionedTupleData
 	void Verify() const;
 
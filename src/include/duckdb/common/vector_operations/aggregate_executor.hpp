@@ -304,6 +304,18 @@ public:
 		}
 	}
 
+	//! Like UnaryUpdate, but flat vectors without NULLs are handed to FLAT_OP::Update as a plain array. FLAT_OP reduces
+	//! the values into a local accumulator before touching the state, which lets the compiler vectorize the loop
+	template <class STATE_TYPE, class INPUT_TYPE, class OP, class FLAT_OP>
+	static void UnaryFlatUpdate(Vector &input, AggregateInputData &aggr_input_data, data_ptr_t state, idx_t count) {
+		if (count != 0 && input.GetVectorType() == VectorType::FLAT_VECTOR && FlatVector::Validity(input).AllValid()) {
+			FLAT_OP::template Update<STATE_TYPE, INPUT_TYPE>(*reinterpret_cast<STATE_TYPE *>(state),
+			                                                  FlatVector::GetData<INPUT_TYPE>(input), count);
+			return;
+		}
+		UnaryUpdate<STATE_TYPE, INPUT_TYPE, OP>(input, aggr_input_data, state, count);
+	}
+
 	template <class STATE_TYPE, class A_TYPE, class B_TYPE, class OP>
 	static void BinaryScatter(AggregateInputData &aggr_input_data, Vector &a, Vector &b, Vector &states, idx_t count) {
 		UnifiedVectorFormat adata, bdata, sdata;
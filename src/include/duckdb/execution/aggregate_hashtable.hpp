@@ -85,6 +85,10 @@ public:
 	void ClearPointerTable();
 	//! Resets the group count to 0
 	void ResetCount();
+	//! Stop probing the pointer table: every row that is added from now on is appended as a new group
+	void SkipLookups();
+	//! Whether lookups in the pointer table are skipped
+	bool SkipsLookups() const;
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
@@ -128,6 +132,8 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether to append rows as new groups without looking them up in the pointer table
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/heavy_hitter_sketch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! The HeavyHitterSketch detects the most frequent hashes in a stream using a Misra-Gries summary
+/*!
+    Only every SAMPLE_RATE-th hash is added to the summary, which keeps at most CAPACITY counters. A counter
+    underestimates the (sampled) frequency of its hash by at most sampled_count / (CAPACITY + 1), so any hash that
+    makes up more than that fraction of the sample is guaranteed to have a counter.
+*/
+class HeavyHitterSketch {
+public:
+	//! The number of counters in the summary
+	static constexpr const idx_t CAPACITY = 32;
+	//! Only every SAMPLE_RATE-th hash is added to the summary
+	static constexpr const idx_t SAMPLE_RATE = 8;
+	//! A hash is a heavy hitter if it makes up at least 1 / HEAVY_HITTER_FRACTION of the sampled hashes
+	static constexpr const idx_t HEAVY_HITTER_FRACTION = 16;
+	//! ... and its estimated frequency is at least this large
+	static constexpr const idx_t MINIMUM_HEAVY_HITTER_COUNT = STANDARD_VECTOR_SIZE;
+
+public:
+	HeavyHitterSketch();
+
+	//! Add (a sample of) the given hashes to the summary
+	void Add(const UnifiedVectorFormat &hashes, const SelectionVector &sel, idx_t count);
+	//! Merge another summary into this one
+	void Merge(const HeavyHitterSketch &other);
+
+	//! Whether or not any of the hashes is a heavy hitter
+	bool HasHeavyHitters() const;
+	//! The estimated frequency of the most frequent heavy hitter (0 if there is none)
+	idx_t MaxHeavyHitterCount() const;
+
+private:
+	void AddSampled(hash_t hash);
+	bool IsHeavyHitter(idx_t sampled_frequency) const;
+
+private:
+	//! The counters of the Misra-Gries summary
+	vector<pair<hash_t, idx_t>> counters;
+	//! The number of hashes that were added to the summary
+	idx_t sampled_count;
+	//! The offset of the next hash to sample in the next call to Add
+	idx_t sample_offset;
+};
+
+} // namespace duckdb
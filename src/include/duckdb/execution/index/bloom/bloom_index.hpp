@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/bloom/bloom_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/filter_propagate_result.hpp"
+#include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+
+namespace duckdb {
+
+class TableFilter;
+
+//! The BloomIndex is a lightweight skip index on a single column. It keeps a blocked bloom filter per range of row
+//! IDs (roughly one row group), which the table scan consults to skip row groups that cannot contain a key.
+//! The bloom index does not support lookups of individual rows, nor constraints. Deleted rows are never removed
+//! from the filters, which only causes false positives.
+class BloomIndex : public BoundIndex {
+public:
+	// Index type name for the bloom index
+	static constexpr const char *TYPE_NAME = "BLOOM";
+	//! The number of filter bits per row
+	static constexpr const idx_t BITS_PER_ROW = 8;
+
+public:
+	//! Constructs a bloom index
+	BloomIndex(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
+	           TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
+	           AttachedDatabase &db, const IndexStorageInfo &info = IndexStorageInfo());
+
+	//! Fixed-size allocator holding one bloom filter per range of row IDs, the filter of the i-th range is always
+	//! the (only) segment of the i-th buffer
+	unique_ptr<FixedSizeAllocator> allocator;
+	//! The number of row ID ranges for which a bloom filter exists
+	idx_t filter_count;
+	//! The size of a bloom filter in bytes (always a power of two)
+	idx_t filter_size;
+	//! The number of rows covered by a bloom filter
+	idx_t rows_per_filter;
+
+public:
+	//! Create a index instance of this type
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input) {
+		auto index = make_uniq<BloomIndex>(input.name, input.constraint_type, input.column_ids, input.table_io_manager,
+		                                   input.unbound_expressions, input.db, input.storage_info);
+		return std::move(index);
+	}
+
+	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
+	ErrorData Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	//! The bloom index has no constraints to verify
+	void VerifyAppend(DataChunk &chunk) override;
+	//! The bloom index has no constraints to verify
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+	//! The bloom index has no constraints to verify
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+	//! Deletes all data from the index. The lock obtained from InitializeLock must be held
+	void CommitDrop(IndexLock &index_lock) override;
+	//! Bits cannot be removed from a bloom filter, so deletes leave the index untouched
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	//! Insert a chunk of (already executed) keys into the index
+	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_identifiers) override;
+	//! Insert the hashes of the keys of a chunk into the filters of their row IDs. NULL keys are skipped.
+	//! The lock obtained from InitializeLock must be held
+	void InsertHashes(IndexLock &lock, Vector &keys, Vector &hashes, Vector &row_identifiers, idx_t count);
+
+	//! Returns FILTER_ALWAYS_FALSE, if no row in [row_start, row_start + count) can pass the filter on the column
+	FilterPropagateResult CheckFilter(column_t column_index, TableFilter &filter, idx_t row_start, idx_t count);
+
+	//! Returns all bloom index storage information for serialization
+	IndexStorageInfo GetStorageInfo(const bool get_buffers) override;
+
+	//! Merge another bloom index into this index by combining their filters
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	//! The filters are never freed, so there is nothing to vacuum
+	void Vacuum(IndexLock &state) override;
+	//! Returns the in-memory usage of the index. The lock obtained from InitializeLock must be held
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+
+	//! Returns the string representation of the bloom index
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+	//! The bloom index never reports constraint violations
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+
+private:
+	//! Returns the filter of a range of row IDs, allocating the filters of all preceding ranges if necessary
+	uint64_t *GetOrCreateFilter(idx_t filter_idx);
+	//! Returns false, if none of the row IDs in [row_start, row_start + count) have a key with that hash
+	bool MightContain(idx_t row_start, idx_t count, hash_t hash);
+	//! Returns false, if none of the row IDs in [row_start, row_start + count) have a key equal to the value
+	bool MightContain(idx_t row_start, idx_t count, const Value &value);
+};
+
+} // namespace duckdb
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/enums/index_constraint_type.hpp"
+#include "duckdb/common/shared_mutex.hpp"
 #include "duckdb/common/types/constraint_conflict_info.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -65,7 +66,7 @@ public:
 	}
 
 public: // Index interface
-	//! Obtain a lock on the index
+	//! Obtain an exclusive lock on the index, readers (lookups and constraint checks) only obtain a shared lock
 	void InitializeLock(IndexLock &state);
 	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
 	virtual ErrorData Append(IndexLock &state, DataChunk &entries, Vector &row_identifiers) = 0;
@@ -128,16 +129,13 @@ public: // Index interface
 	vector<unique_ptr<Expression>> unbound_expressions;
 
 protected:
-	//! Lock used for any changes to the index
-	mutex lock;
+	//! Lock used for any changes to the index (exclusive) and for lookups (shared)
+	SharedMutex lock;
 
 	//! Bound expressions used during expression execution
 	vector<unique_ptr<Expression>> bound_expressions;
 
 private:
-	//! Expression executor to execute the index expressions
-	ExpressionExecutor executor;
-
 	//! Bind the unbound expressions of the index
 	unique_ptr<Expression> BindExpression(unique_ptr<Expression> expr);
 };
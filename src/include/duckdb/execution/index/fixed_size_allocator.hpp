@@ -52,8 +52,16 @@ public:
 		D_ASSERT(ptr.GetOffset() < available_segments_per_buffer);
 		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
 		auto &buffer = buffers.find(ptr.GetBufferId())->second;
-		auto buffer_ptr = buffer.Get(dirty);
-		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
+		if (dirty) {
+			// only writers, which hold the index lock exclusively, modify the buffer
+			return buffer.Get() + ptr.GetOffset() * segment_size + bitmask_offset;
+		}
+		if (!buffer.InMemory()) {
+			// readers holding a shared lock on the index can try to load the same buffer concurrently
+			lock_guard<mutex> guard(load_lock);
+			return buffer.GetReadOnly() + ptr.GetOffset() * segment_size + bitmask_offset;
+		}
+		return buffer.GetReadOnly() + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
 
 	//! Resets the allocator, e.g., during 'DELETE FROM table'
@@ -115,6 +123,8 @@ private:
 	unordered_set<idx_t> buffers_with_free_space;
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
+	//! Lock for loading on-disk buffers into memory
+	mutex load_lock;
 
 private:
 	//! Returns an available buffer id
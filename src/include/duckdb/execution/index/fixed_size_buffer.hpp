@@ -10,6 +10,7 @@
 
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/block_manager.hpp"
 
@@ -45,6 +46,7 @@ public:
 	//! Constructor for deserializing buffer metadata from disk
 	FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
 	                const BlockPointer &block_pointer);
+	FixedSizeBuffer(FixedSizeBuffer &&other) noexcept;
 
 	//! Block manager of the database instance
 	BlockManager &block_manager;
@@ -65,19 +67,26 @@ public:
 public:
 	//! Returns true, if the buffer is in-memory
 	inline bool InMemory() const {
-		return buffer_handle.IsValid();
+		return in_memory.load(std::memory_order_acquire);
 	}
 	//! Returns true, if the block is on-disk
 	inline bool OnDisk() const {
 		return block_pointer.IsValid();
 	}
-	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory
-	inline data_ptr_t Get(const bool dirty_p = true) {
+	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory.
+	//! Marks the buffer as dirty, i.e., the caller must have exclusive access to the index
+	inline data_ptr_t Get() {
 		if (!InMemory()) {
 			Pin();
 		}
-		if (dirty_p) {
-			dirty = dirty_p;
+		dirty = true;
+		return buffer_handle.Ptr();
+	}
+	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory.
+	//! Does not modify the buffer, but loading it must be serialized between concurrent readers
+	inline data_ptr_t GetReadOnly() {
+		if (!InMemory()) {
+			Pin();
 		}
 		return buffer_handle.Ptr();
 	}
@@ -98,6 +107,8 @@ private:
 	BufferHandle buffer_handle;
 	//! The block handle of the on-disk buffer
 	shared_ptr<BlockHandle> block_handle;
+	//! True, if the buffer handle is valid. Readers can check this without holding a lock
+	atomic<bool> in_memory;
 
 private:
 	//! Returns the maximum non-free offset in a bitmask
@@ -17,12 +17,14 @@
 #include "duckdb/common/types/row/tuple_data_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/execution/heavy_hitter_sketch.hpp"
 #include "duckdb/execution/ht_entry.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 
+class BloomFilter;
 class BufferManager;
 class BufferHandle;
 class ColumnDataCollection;
@@ -77,6 +79,9 @@ public:
 		SelectionVector sel_vector;
 		SelectionVector chain_match_sel_vector;
 		SelectionVector chain_no_match_sel_vector;
+		//! The probe-side rows and build-side rows of the result when following multiple links of the chains at once
+		SelectionVector lhs_sel_vector;
+		Vector rhs_pointers;
 
 		// whether or not the given tuple has found a match
 		unsafe_unique_array<bool> found_match;
@@ -93,6 +98,8 @@ public:
 	private:
 		//! Next operator for the inner join
 		void NextInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
+		//! Next operator for the inner join that follows the chains until the result is full (for long chains)
+		void NextCompactedInnerJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Next operator for the semi join
 		void NextSemiJoin(DataChunk &keys, DataChunk &left, DataChunk &result);
 		//! Next operator for the anti join
@@ -174,6 +181,8 @@ public:
 	//! Finalize must be called before any call to Probe, and after Finalize is called Build should no longer be
 	//! ever called.
 	void Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool parallel);
+	//! Inserts the hashes of all keys into the bloom filter, for when the pointer table is not built
+	void FillBloomFilter();
 	//! Probe the HT with the given input chunk, resulting in the given result
 	void Probe(ScanStructure &scan_structure, DataChunk &keys, TupleDataChunkState &key_state, ProbeState &probe_state,
 	           optional_ptr<Vector> precomputed_hashes = nullptr);
@@ -234,6 +243,8 @@ public:
 
 	//! If there is more than one element in the chain, we need to scan the next elements of the chain
 	bool chains_longer_than_one;
+	//! Summary of the most frequent build-side key hashes, used to detect heavy hitters (skew)
+	HeavyHitterSketch heavy_hitters;
 
 	//! The capacity of the HT. Is the same as hash_map.GetSize() / sizeof(ht_entry_t)
 	idx_t capacity;
@@ -253,6 +264,8 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Bloom filter that is filled with the hashes of the keys during Finalize (if any)
+	optional_ptr<BloomFilter> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -392,11 +405,18 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize();
-	//! Sets number of radix bits according to the max ht size
-	void SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts, const idx_t max_ht_size,
-	                             const idx_t max_partition_size, const idx_t max_partition_count);
+	//! Whether adding radix bits is expected to shrink the largest partition
+	//! (false if it is dominated by heavy hitters)
+	bool CanRepartition(const idx_t max_ht_size, const idx_t max_partition_size,
+	                    const idx_t max_partition_count) const;
+	//! Sets number of radix bits according to the max ht size, returns the sink collection with the previous radix bits
+	unique_ptr<PartitionedTupleData> SetRepartitionRadixBits(vector<unique_ptr<JoinHashTable>> &local_hts,
+	                                                         const idx_t max_ht_size, const idx_t max_partition_size,
+	                                                         const idx_t max_partition_count);
 	//! Partition this HT
 	void Repartition(JoinHashTable &global_ht);
+	//! Partition a range of the partitions of the previous sink collection of this HT into this HT
+	void Repartition(PartitionedTupleData &old_sink_collection, const idx_t partition_start, const idx_t partition_end);
 
 	//! Delete blocks that belong to the current partitioned HT
 	void Reset();
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate performs a group-by and aggregation over input that arrives ordered on the groups, i.e.,
+//! all rows of a group are adjacent. It keeps the state of a single group at a time and emits each group as soon as
+//! the group keys change.
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                           vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+public:
+	//! Whether the aggregates can be computed by this operator
+	static bool CanStreamAggregates(const vector<unique_ptr<Expression>> &aggregates);
+
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const final;
+
+	bool RequiresFinalExecute() const final {
+		return true;
+	}
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
@@ -13,8 +13,10 @@
 #include "duckdb/planner/column_binding.hpp"
 
 namespace duckdb {
+class BloomFilter;
 class DataChunk;
 class DynamicTableFilterSet;
+class JoinHashTable;
 struct GlobalUngroupedAggregateState;
 struct LocalUngroupedAggregateState;
 
@@ -30,6 +32,8 @@ struct JoinFilterGlobalState {
 
 	//! Global Min/Max aggregates for filter pushdown
 	unique_ptr<GlobalUngroupedAggregateState> global_aggregate_state;
+	//! Bloom filter over the build-side keys, filled while finalizing the hash table (if any)
+	unique_ptr<BloomFilter> bloom_filter;
 };
 
 struct JoinFilterLocalState {
@@ -53,7 +57,12 @@ public:
 
 	void Sink(DataChunk &chunk, JoinFilterLocalState &lstate) const;
 	void Combine(JoinFilterGlobalState &gstate, JoinFilterLocalState &lstate) const;
-	void PushFilters(JoinFilterGlobalState &gstate, const PhysicalOperator &op) const;
+	void PushFilters(ClientContext &context, JoinHashTable &ht, JoinFilterGlobalState &gstate,
+	                 const PhysicalOperator &op) const;
+	//! Sets up a bloom filter that is filled while finalizing the hash table (if we can push one)
+	void InitializeBloomFilter(ClientContext &context, JoinFilterGlobalState &gstate, JoinHashTable &ht) const;
+	//! Pushes the (filled) bloom filter into the probe side
+	void PushBloomFilter(JoinFilterGlobalState &gstate, JoinHashTable &ht, const PhysicalOperator &op) const;
 };
 
 } // namespace duckdb
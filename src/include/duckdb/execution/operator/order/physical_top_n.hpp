@@ -12,6 +12,8 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
+class TopNHeap;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -26,6 +28,8 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The dynamic filter on the first ORDER BY column that is pushed into the scan (if any)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
@@ -55,6 +59,10 @@ public:
 	}
 
 	string ParamsToString() const override;
+
+private:
+	//! Tightens the dynamic filter using the boundary of the heap
+	void UpdateDynamicFilter(TopNHeap &heap) const;
 };
 
 } // namespace duckdb
@@ -33,6 +33,8 @@ public:
 	vector<unique_ptr<Expression>> bound_defaults;
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
 	bool update_is_del_and_insert;
+	//! Whether every row of the table is updated exactly once - no duplicate row ids need to be filtered
+	bool update_rewrites_table = false;
 	//! If the returning statement is present, return the whole chunk
 	bool return_chunk;
 
@@ -18,11 +18,14 @@
 
 namespace duckdb {
 class DuckTableEntry;
+class CreateARTIndexLocalSinkState;
 
 //! Physical CREATE (UNIQUE) INDEX statement
 class PhysicalCreateARTIndex : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
+	//! The maximum number of sorted keys that a thread bulk-loads into an ART at once
+	static constexpr const idx_t SORTED_RUN_CAPACITY = 512 * STANDARD_VECTOR_SIZE;
 
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
@@ -56,8 +59,10 @@ public:
 
 	//! Sink for unsorted data: insert iteratively
 	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
+	//! Sink for sorted data: collect runs of sorted keys
 	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
+	//! Bulk-load the current sorted run: build bottom-up + merge
+	void BulkLoadSortedRun(CreateARTIndexLocalSinkState &l_state) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
@@ -140,6 +140,33 @@ public:
 	WindowAggregationMode mode;
 };
 
+//! Evaluates frames that slide monotonically through the partition (e.g., ROWS BETWEEN N PRECEDING AND CURRENT ROW)
+//! without building a segment tree. Invertible aggregates keep a running total and subtract the evicted rows, all other
+//! combinable aggregates use two-stack aggregation.
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	//! The running totals that can be maintained by subtracting evicted rows
+	enum class InverseType : uint8_t { NONE, COUNT, SUM, AVERAGE, AVERAGE_HUGEINT };
+
+	//! The maximum width of the frames, which bounds the number of stacked states
+	static constexpr idx_t MAX_FRAME_WIDTH = STANDARD_VECTOR_SIZE;
+
+	WindowSlidingAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
+	                        const LogicalType &result_type_p, const WindowExcludeMode exclude_mode_p);
+	~WindowSlidingAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState(const WindowAggregatorState &gstate) const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+
+	//! Whether the aggregate can be evaluated by sliding the frames
+	static bool CanAggregate(const AggregateObject &aggr, const vector<LogicalType> &arg_types,
+	                         const LogicalType &result_type);
+
+	//! The running total of invertible aggregates
+	const InverseType inverse;
+};
+
 class WindowDistinctAggregator : public WindowAggregator {
 public:
 	WindowDistinctAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
@@ -248,6 +248,13 @@ public:
 		AggregateExecutor::UnaryUpdate<STATE, INPUT_TYPE, OP>(inputs[0], aggr_input_data, state, count);
 	}
 
+	template <class STATE, class INPUT_TYPE, class OP, class FLAT_OP>
+	static void UnaryFlatUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+	                            data_ptr_t state, idx_t count) {
+		D_ASSERT(input_count == 1);
+		AggregateExecutor::UnaryFlatUpdate<STATE, INPUT_TYPE, OP, FLAT_OP>(inputs[0], aggr_input_data, state, count);
+	}
+
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
 	static void UnaryWindow(AggregateInputData &aggr_input_data, const WindowPartitionInput &partition,
 	                        const_data_ptr_t g_state, data_ptr_t l_state, const SubFrames &subframes, Vector &result,
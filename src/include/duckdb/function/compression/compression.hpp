@@ -33,6 +33,11 @@ struct BitpackingFun {
 	static bool TypeIsSupported(const PhysicalType physical_type);
 };
 
+struct PForDeltaFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const PhysicalType physical_type);
+};
+
 struct DictionaryCompressionFun {
 	static CompressionFunction GetFunction(PhysicalType type);
 	static bool TypeIsSupported(const PhysicalType physical_type);
@@ -63,4 +68,9 @@ struct FSSTFun {
 	static bool TypeIsSupported(const PhysicalType physical_type);
 };
 
+struct ZSTDFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const PhysicalType physical_type);
+};
+
 } // namespace duckdb
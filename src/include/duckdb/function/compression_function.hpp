@@ -22,7 +22,9 @@ class ColumnData;
 class ColumnDataCheckpointer;
 class ColumnSegment;
 class SegmentStatistics;
+class TableFilter;
 struct ColumnSegmentState;
+struct SelectionVector;
 
 struct ColumnFetchState;
 struct ColumnScanState;
@@ -169,6 +171,16 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for scanning an entire vector while evaluating a filter on the compressed data (optional).
+//! The rows in 'sel' that do not pass the filter are removed from it, and only the rows that pass have to be written
+//! to the result. The validity of the result has already been scanned: NULL rows never pass the filter.
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                     Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                     const TableFilter &filter);
+//! Function prototype used for scanning only the selected rows of an entire vector (optional). The selected rows are
+//! written densely to the start of the result.
+typedef void (*compression_select_t)(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                     const SelectionVector &sel, idx_t sel_count);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -212,7 +224,7 @@ public:
 	      init_prefetch(init_prefetch), init_scan(init_scan), scan_vector(scan_vector), scan_partial(scan_partial),
 	      fetch_row(fetch_row), skip(skip), init_segment(init_segment), init_append(init_append), append(append),
 	      finalize_append(finalize_append), revert_append(revert_append), serialize_state(serialize_state),
-	      deserialize_state(deserialize_state), cleanup_state(cleanup_state) {
+	      deserialize_state(deserialize_state), cleanup_state(cleanup_state), filter(nullptr), select(nullptr) {
 	}
 
 	//! Compression type
@@ -280,6 +292,16 @@ public:
 	compression_deserialize_state_t deserialize_state;
 	//! Cleanup the segment state (optional)
 	compression_cleanup_state_t cleanup_state;
+
+	// Filter pushdown
+	//! This is only worth defining if a filter can be evaluated on the compressed data more cheaply than on the
+	//! scanned vector, e.g. once per dictionary entry or run
+
+	//! Scan an entire vector while filtering it (optional)
+	compression_filter_t filter;
+	//! Scan only the selected rows of an entire vector (optional)
+	//! This is only worth defining if decompressing a subset of the rows is cheaper than decompressing all of them
+	compression_select_t select;
 };
 
 //! The set of compression functions
@@ -97,6 +97,8 @@ struct ClientConfig {
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 	//! The amount of rows we can keep open before we close and flush them during a partitioned write
 	idx_t partitioned_write_max_open_files = idx_t(100);
+	//! The maximum number of rows in the build side of a hash join to push its keys as an IN filter into the probe side
+	idx_t dynamic_in_filter_threshold = 50;
 	//! The number of rows we need on either table to choose a nested loop join
 	idx_t nested_loop_join_threshold = 5;
 	//! The number of rows we need on either table to choose a merge join over an IE join
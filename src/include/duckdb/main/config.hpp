@@ -60,6 +60,26 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+enum class TemporaryFileCompression : uint8_t {
+	//! Blocks are written to the temporary files uncompressed
+	NONE = 0,
+	//! Blocks are compressed with LZ4
+	LZ4 = 1,
+	//! Blocks are compressed with ZSTD
+	ZSTD = 2,
+	//! Pick the smallest of LZ4, ZSTD and no compression for every block, only trying ZSTD if LZ4 compresses the block
+	ADAPTIVE = 3
+};
+
+enum class TaskSchedulerMode : uint8_t {
+	//! All tasks are scheduled in a single global queue
+	GLOBAL_QUEUE = 0,
+	//! Tasks are scheduled in per-CPU deques, idle threads steal tasks from the other deques
+	WORK_STEALING = 1,
+	//! Work stealing, with the worker threads pinned to NUMA nodes
+	NUMA_WORK_STEALING = 2
+};
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -123,8 +143,14 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The maximum time (in microseconds) a commit waits for other commits to join its WAL sync (group commit)
+	idx_t wal_group_commit_delay = 0;
+	//! The number of pending commits after which a WAL sync no longer waits for other commits to join
+	idx_t wal_group_commit_size = 16;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! The number of row groups ahead of a table scan whose blocks are read asynchronously (0 = disabled)
+	idx_t storage_read_ahead = 0;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
 #ifdef DUCKDB_EXTENSION_AUTOLOAD_DEFAULT
@@ -152,10 +178,14 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! How the task scheduler distributes tasks over the threads
+	TaskSchedulerMode scheduler_mode = TaskSchedulerMode::GLOBAL_QUEUE;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! How blocks that are offloaded to the temporary directory are compressed
+	TemporaryFileCompression temp_file_compression = TemporaryFileCompression::NONE;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -15,10 +15,28 @@
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/constants.hpp"
+#include "duckdb/common/optional_ptr.hpp"
 
 namespace duckdb {
 
-enum class MetricsType : uint8_t { CPU_TIME, EXTRA_INFO, OPERATOR_CARDINALITY, OPERATOR_TIMING };
+enum class MetricsType : uint8_t {
+	CPU_TIME,
+	EXTRA_INFO,
+	OPERATOR_CARDINALITY,
+	OPERATOR_TIMING,
+	BYTES_READ,
+	BYTES_WRITTEN,
+	ROWS_FILTERED,
+	ROW_GROUPS_SKIPPED,
+	SEGMENTS_SKIPPED,
+	HASH_TABLE_SIZE,
+	HASH_TABLE_RESIZES,
+	SPILL_BYTES,
+	BUFFER_PINS,
+	BUFFER_EVICTIONS,
+	IO_WAIT_TIME,
+	SCHEDULER_WAIT_TIME
+};
 
 struct MetricsTypeHashFunction {
 	uint64_t operator()(const MetricsType &index) const {
@@ -38,6 +56,40 @@ struct SettingSetFunctions {
 		}
 		return false;
 	}
+
+	//! Whether or not the metric is collected by the components an operator calls into (see OperatorMetrics)
+	static bool IsOperatorMetric(const MetricsType setting);
+	//! Whether or not any of the enabled metrics is collected by the components an operator calls into
+	static bool OperatorMetricsEnabled(const profiler_settings_t &settings);
+};
+
+//! The counters of the work done on behalf of an operator, e.g., by the storage or the buffer manager
+struct OperatorMetrics {
+	idx_t bytes_read;
+	idx_t bytes_written;
+	idx_t rows_filtered;
+	idx_t row_groups_skipped;
+	idx_t segments_skipped;
+	idx_t hash_table_size;
+	idx_t hash_table_resizes;
+	idx_t spill_bytes;
+	idx_t buffer_pins;
+	idx_t buffer_evictions;
+	double io_wait_time;
+	double scheduler_wait_time;
+
+	OperatorMetrics()
+	    : bytes_read(0), bytes_written(0), rows_filtered(0), row_groups_skipped(0), segments_skipped(0),
+	      hash_table_size(0), hash_table_resizes(0), spill_bytes(0), buffer_pins(0), buffer_evictions(0),
+	      io_wait_time(0), scheduler_wait_time(0) {
+	}
+
+	void Add(const OperatorMetrics &other);
+
+	//! The metrics of the operator that is currently profiled on this thread, or nullptr if there is none
+	DUCKDB_API static optional_ptr<OperatorMetrics> Active();
+	//! Set (or clear) the metrics of the operator that is currently profiled on this thread
+	DUCKDB_API static void SetActive(optional_ptr<OperatorMetrics> metrics);
 };
 
 struct Metrics {
@@ -45,6 +97,7 @@ struct Metrics {
 	string extra_info;
 	idx_t operator_cardinality;
 	double operator_timing;
+	OperatorMetrics operator_metrics;
 
 	Metrics() : cpu_time(0), operator_cardinality(0), operator_timing(0) {
 	}
@@ -38,6 +38,8 @@ struct OperatorInformation {
 	double time;
 	idx_t elements;
 	string name;
+	//! The work done on behalf of the operator
+	OperatorMetrics metrics;
 
 	void AddTime(double n_time) {
 		this->time += n_time;
@@ -63,17 +65,25 @@ public:
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor, const string &name,
 	                      int id);
 	DUCKDB_API OperatorInformation &GetOperatorInfo(const PhysicalOperator &phys_op);
+	//! Returns the metrics of the operator if they are collected, i.e., if any of the operator metrics is enabled
+	DUCKDB_API optional_ptr<OperatorMetrics> GetOperatorMetrics(const PhysicalOperator &phys_op);
 
 	static bool SettingEnabled(const MetricsType setting) {
 		return SettingSetFunctions::Enabled(ProfilingInfo::DefaultSettings(), setting);
 	}
 
 	~OperatorProfiler() {
+		if (operator_metrics_enabled && active_operator) {
+			// the active operator did not end (e.g., because it threw an exception)
+			OperatorMetrics::SetActive(nullptr);
+		}
 	}
 
 private:
 	//! Whether or not the profiler is enabled
 	bool enabled;
+	//! Whether or not the metrics collected by the components the operators call into are enabled
+	bool operator_metrics_enabled;
 	profiler_settings_t settings;
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
@@ -195,6 +195,16 @@ struct DisabledOptimizersSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct DynamicInFilterThreshold {
+	static constexpr const char *Name = "dynamic_in_filter_threshold";
+	static constexpr const char *Description =
+	    "The maximum number of rows in the build side of a hash join to push the join keys as an IN filter";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableExternalAccessSetting {
 	static constexpr const char *Name = "enable_external_access";
 	static constexpr const char *Description =
@@ -725,6 +735,16 @@ struct ProgressBarTimeSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct SchedulerModeSetting {
+	static constexpr const char *Name = "scheduler_mode";
+	static constexpr const char *Description =
+	    "How tasks are distributed over the threads (global_queue, work_stealing or numa_work_stealing)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct SchemaSetting {
 	static constexpr const char *Name = "schema";
 	static constexpr const char *Description =
@@ -763,6 +783,26 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct StorageReadAheadSetting {
+	static constexpr const char *Name = "storage_read_ahead";
+	static constexpr const char *Description =
+	    "The number of row groups ahead of a table scan whose blocks are read asynchronously from the database file";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "How blocks that are offloaded to the temp_directory are compressed (none, lz4, zstd or adaptive)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -781,6 +821,26 @@ struct UsernameSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALGroupCommitDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_delay";
+	static constexpr const char *Description =
+	    "The maximum time in microseconds that a commit waits for concurrent commits to share its WAL sync";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitSizeSetting {
+	static constexpr const char *Name = "wal_group_commit_size";
+	static constexpr const char *Description =
+	    "The number of pending commits at which a WAL sync stops waiting for more commits to join";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct FlushAllocatorSetting {
 	static constexpr const char *Name = "allocator_flush_threshold";
 	static constexpr const char *Description =
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/profiler.hpp"
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -33,6 +34,8 @@ public:
 
 	Pipeline &pipeline;
 	unique_ptr<PipelineExecutor> pipeline_executor;
+	//! Measures the time the task waits to be executed after it was (re-)scheduled
+	Profiler scheduler_wait;
 
 public:
 	const PipelineExecutor &GetPipelineExecutor() const;
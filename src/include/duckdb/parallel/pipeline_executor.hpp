@@ -60,6 +60,8 @@ public:
 
 	//! Registers the task in the interrupt_state to allow Source/Sink operators to block the task
 	void SetTaskForInterrupts(weak_ptr<Task> current_task);
+	//! Adds the time the task waited for the scheduler to the metrics of the source (if profiled)
+	void AddSchedulerWaitTime(double wait_time);
 
 private:
 	//! The pipeline to process
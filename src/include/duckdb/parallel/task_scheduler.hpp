@@ -21,6 +21,7 @@ struct QueueProducerToken;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
+enum class TaskSchedulerMode : uint8_t;
 
 struct SchedulerThread;
 
@@ -65,6 +66,9 @@ public:
 
 	void RelaunchThreads();
 
+	//! Sets how tasks are distributed over the threads - the threads are relaunched when NUMA pinning changes
+	void SetSchedulerMode(TaskSchedulerMode mode);
+
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
 
@@ -105,6 +109,8 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! Whether the threads must be relaunched the next time RelaunchThreads is called (e.g. to apply NUMA pinning)
+	atomic<bool> relaunch_required;
 };
 
 } // namespace duckdb
@@ -32,6 +32,9 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The columns the table is clustered on (WITH (order_by = '...')). Row groups that are written during a
+	//! checkpoint are sorted on these columns, so that the zonemaps can prune range filters on them.
+	vector<string> order_by;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
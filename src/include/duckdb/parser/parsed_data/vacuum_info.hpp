@@ -20,11 +20,13 @@ class Serializer;
 class Deserializer;
 
 struct VacuumOptions {
-	VacuumOptions() : vacuum(false), analyze(false) {
+	VacuumOptions() : vacuum(false), analyze(false), full(false) {
 	}
 
 	bool vacuum;
 	bool analyze;
+	//! Rewrite all row groups of a clustered table in clustering order at the next checkpoint
+	bool full;
 
 	void Serialize(Serializer &serializer) const;
 	static VacuumOptions Deserialize(Deserializer &deserializer);
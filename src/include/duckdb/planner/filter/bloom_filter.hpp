@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+class SelectionVector;
+class Vector;
+
+//! The bit array of a bloom filter, shared between all copies of a BloomFilter
+struct BloomFilterData {
+	explicit BloomFilterData(idx_t block_count);
+
+	//! The number of 64-bit blocks (always a power of two)
+	idx_t block_count;
+	//! The blocks of the bloom filter - atomic so that the filter can be built in parallel
+	unsafe_unique_array<atomic<uint64_t>> blocks;
+};
+
+//! BloomFilter is a probabilistic filter on the hashes of a column, used for pushing down hash join keys
+//! Every key is assigned to a single 64-bit block, in which BITS_PER_HASH bits are set
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+	//! The number of bits reserved per key
+	static constexpr const idx_t BITS_PER_KEY = 16;
+	//! The number of bits that are set in a block per hash
+	static constexpr const idx_t BITS_PER_HASH = 4;
+	//! The maximum number of keys we create a bloom filter for (results in a bloom filter of at most 64MB)
+	static constexpr const idx_t MAX_KEY_COUNT = 33554432;
+
+public:
+	explicit BloomFilter(idx_t key_count);
+	explicit BloomFilter(shared_ptr<BloomFilterData> data);
+
+	//! The bit array of the bloom filter
+	shared_ptr<BloomFilterData> data;
+
+public:
+	//! Inserts hashes into the bloom filter - this is safe to call concurrently from multiple threads
+	void InsertHashes(const hash_t *hashes, idx_t count);
+	//! Returns false if the hash is definitely not in the bloom filter
+	bool LookupHash(hash_t hash) const;
+	//! Returns the bits that are set for a hash within its 64-bit block
+	static uint64_t GetMask(hash_t hash);
+	//! Hashes the rows in "sel" of "vector", and removes the rows that are NULL or definitely not in the bloom filter
+	idx_t Filter(Vector &vector, idx_t count, SelectionVector &sel, idx_t approved_tuple_count) const;
+
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
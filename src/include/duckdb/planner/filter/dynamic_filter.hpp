@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The state of a dynamic filter, shared between the operator that updates it and all copies of the filter
+struct DynamicFilterData {
+	mutex lock;
+	//! The current filter - only applied once it has been initialized
+	unique_ptr<ConstantFilter> filter;
+	//! Whether or not the filter has been initialized
+	bool initialized = false;
+
+	//! Resets the filter to the uninitialized state
+	void Reset();
+};
+
+//! DynamicFilter is a constant comparison that is updated while the query is running (e.g. by a Top-N)
+//! As long as it has not been initialized, the filter does not remove any rows
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter state
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
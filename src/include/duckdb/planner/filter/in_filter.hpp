@@ -0,0 +1,39 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/in_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class InFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::IN_FILTER;
+
+public:
+	explicit InFilter(vector<Value> values);
+
+	//! The (distinct, non-NULL) values to filter on
+	vector<Value> values;
+	//! The values in sorted order, so that scans can binary search them for every row
+	Vector sorted_values;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -31,6 +31,8 @@ public:
 	vector<unique_ptr<Expression>> bound_defaults;
 	vector<unique_ptr<BoundConstraint>> bound_constraints;
 	bool update_is_del_and_insert;
+	//! Whether the update rewrites every row of the table exactly once (i.e. the row ids are unique)
+	bool update_rewrites_table = false;
 
 public:
 	void Serialize(Serializer &serializer) const override;
@@ -28,7 +28,10 @@ enum class TableFilterType : uint8_t {
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
 	CONJUNCTION_AND = 4,
-	STRUCT_EXTRACT = 5
+	STRUCT_EXTRACT = 5,
+	BLOOM_FILTER = 6, // bloom filter on the hashes of the column (e.g. pushed down from a hash join)
+	IN_FILTER = 7,    // IN list of constants (e.g. the distinct keys of a small hash join build side)
+	DYNAMIC_FILTER = 8 // constant comparison that is updated during execution (e.g. the boundary of a Top-N)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
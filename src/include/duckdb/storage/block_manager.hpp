@@ -56,6 +56,9 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Asynchronously load a set of blocks into the buffer pool. Note that this is a performance suggestion.
+	virtual void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
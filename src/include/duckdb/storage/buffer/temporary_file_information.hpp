@@ -14,6 +14,8 @@ struct MemoryInformation {
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size of the blocks in the file before they were compressed
+	idx_t uncompressed_size;
 };
 
 } // namespace duckdb
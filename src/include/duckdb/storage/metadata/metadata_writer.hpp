@@ -27,6 +27,8 @@ public:
 
 	BlockPointer GetBlockPointer();
 	MetaBlockPointer GetMetaBlockPointer();
+	//! Sets the list to which the pointers of any newly written blocks are added (or nullptr to stop adding them)
+	void SetWrittenPointers(optional_ptr<vector<MetaBlockPointer>> written_pointers);
 	MetadataManager &GetManager() {
 		return manager;
 	}
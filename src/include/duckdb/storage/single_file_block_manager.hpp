@@ -15,8 +15,12 @@
 #include "duckdb/common/unordered_set.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/common/vector.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/main/config.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 class DatabaseInstance;
@@ -33,9 +37,12 @@ struct StorageManagerOptions {
 class SingleFileBlockManager : public BlockManager {
 	//! The location in the file where the block writing starts
 	static constexpr uint64_t BLOCK_START = Storage::FILE_HEADER_SIZE * 3;
+	//! The maximum number of pending read-ahead requests
+	static constexpr idx_t MAX_READ_AHEAD_REQUESTS = 64;
 
 public:
 	SingleFileBlockManager(AttachedDatabase &db, const string &path, const StorageManagerOptions &options);
+	~SingleFileBlockManager() override;
 
 	FileOpenFlags GetFileFlags(bool create_new) const;
 	//! Creates a new database.
@@ -65,6 +72,8 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Queue a set of blocks to be read into the buffer pool by the read-ahead thread
+	void ReadAhead(vector<shared_ptr<BlockHandle>> &handles) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -98,6 +107,10 @@ private:
 	vector<MetadataHandle> GetFreeListBlocks();
 	void TrimFreeBlocks();
 
+	//! Reads the queued read-ahead requests until the block manager is destroyed
+	void ReadAheadLoop();
+	void StopReadAhead();
+
 private:
 	AttachedDatabase &db;
 	//! The active DatabaseHeader, either 0 (h1) or 1 (h2)
@@ -130,5 +143,16 @@ private:
 	StorageManagerOptions options;
 	//! Lock for performing various operations in the single file block manager
 	mutex block_lock;
+	//! Lock for the read-ahead queue
+	mutex read_ahead_lock;
+	//! Signals the read-ahead thread that requests are queued or that it should stop
+	std::condition_variable read_ahead_cv;
+	//! The queued read-ahead requests. We do not keep the blocks alive: blocks that are destroyed in the meantime
+	//! (e.g. because their segment was dropped) are skipped.
+	deque<vector<weak_ptr<BlockHandle>>> read_ahead_queue;
+	//! The read-ahead thread (if any)
+	unique_ptr<thread> read_ahead_thread;
+	//! Whether or not the read-ahead thread should stop
+	bool read_ahead_shutdown = false;
 };
 } // namespace duckdb
@@ -83,6 +83,10 @@ public:
 	bool IsLoaded() const {
 		return load_complete;
 	}
+	//! Requests the next checkpoint to be written even if the WAL is empty (e.g., to re-cluster a table)
+	void RequestCheckpoint() {
+		checkpoint_requested = true;
+	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
 	bool InMemory();
@@ -110,6 +114,8 @@ protected:
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
 	//! return nullptr when loading a database
 	bool load_complete = false;
+	//! Whether or not the next full checkpoint has to be written regardless of the WAL size
+	atomic<bool> checkpoint_requested {false};
 
 public:
 	template <class TARGET>
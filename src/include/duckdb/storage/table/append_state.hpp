@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/shared_mutex.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/common/vector.hpp"
@@ -52,7 +53,7 @@ struct RowGroupAppendState {
 };
 
 struct IndexLock {
-	unique_lock<mutex> index_lock;
+	unique_lock<SharedMutex> index_lock;
 };
 
 struct TableAppendState {
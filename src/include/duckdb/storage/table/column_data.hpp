@@ -112,6 +112,11 @@ public:
 	                        SelectionVector &sel, idx_t count);
 	virtual void FilterScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
 	                                 idx_t count, bool allow_updates);
+	//! Whether the vector can be scanned by only decompressing the selected rows (late materialization)
+	bool CanScanSelection(ColumnScanState &state, idx_t target_scan, Vector &result);
+	//! Scans only the selected rows of an entire vector from the current segment, and writes them densely to the result
+	void ScanSelection(ColumnScanState &state, Vector &result, idx_t target_scan, const SelectionVector &sel,
+	                   idx_t sel_count);
 
 	//! Skip the scan forward by "count" rows
 	virtual void Skip(ColumnScanState &state, idx_t count = STANDARD_VECTOR_SIZE);
@@ -171,6 +176,8 @@ protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
 
+	//! Prepares the scan state for scanning the next vector from the current segment
+	void BeginScanVector(ColumnScanState &state);
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type);
 	//! Scans a vector from the column merged with any potential updates
@@ -178,6 +185,10 @@ protected:
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                 idx_t target_scan);
+	//! Scans an entire vector from the current segment while evaluating the filter on the compressed data
+	//! Only the rows that pass the filter are written to the result
+	void FilterVector(ColumnScanState &state, Vector &result, idx_t target_scan, SelectionVector &sel,
+	                  idx_t &approved_tuple_count, const TableFilter &filter);
 
 	void ClearUpdates();
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
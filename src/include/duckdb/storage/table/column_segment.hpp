@@ -72,8 +72,21 @@ public:
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 
+	//! Scan one entire vector from this segment, and filter it on the compressed data. Only the rows that pass the
+	//! filter are written to the result. Only supported if the compression function defines a filter function.
+	void Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+	            idx_t &approved_tuple_count, const TableFilter &filter);
+
+	//! Scan only the selected rows of one entire vector from this segment, and write them densely to the result.
+	//! Only supported if the compression function defines a select function.
+	void Select(ColumnScanState &state, idx_t scan_count, Vector &result, const SelectionVector &sel, idx_t sel_count);
+
 	static idx_t FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
 	                             const TableFilter &filter, idx_t scan_count, idx_t &approved_tuple_count);
+	//! Whether the filter can be evaluated by compression functions: it must only consist of comparisons that never
+	//! pass for NULL values, so that it can be evaluated on the distinct non-NULL values of a segment
+	static bool CanFilterCompressed(const TableFilter &filter);
+	static bool CanFilterCompressed(const vector<unique_ptr<TableFilter>> &filters);
 
 	//! Skip a scan forward to the row_index specified in the scan state
 	void Skip(ColumnScanState &state);
@@ -49,6 +49,14 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Whether or not the next full checkpoint should rewrite all row groups in clustering order (VACUUM FULL)
+	bool GetRecluster() const {
+		return recluster;
+	}
+	void SetRecluster(bool recluster_p) {
+		recluster = recluster_p;
+	}
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +74,8 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! Whether or not the next full checkpoint should re-cluster all row groups
+	atomic<bool> recluster;
 };
 
 } // namespace duckdb
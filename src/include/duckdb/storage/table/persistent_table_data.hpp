@@ -26,6 +26,26 @@ public:
 	idx_t total_rows;
 	idx_t row_group_count;
 	MetaBlockPointer block_pointer;
+	//! The location of the table statistics and row group pointers, which are only read on first access
+	MetaBlockPointer table_pointer;
+};
+
+//! Reads the table statistics and row group pointers of a table when they are first needed, so that opening a
+//! database does not require reading the data of every table
+class PersistentTableDataLoader {
+public:
+	PersistentTableDataLoader(MetadataManager &metadata_manager, MetaBlockPointer table_pointer,
+	                          vector<LogicalType> types);
+
+	//! Reads the table data, if it has not been read yet
+	PersistentTableData &Load();
+
+private:
+	mutex load_lock;
+	MetadataManager &metadata_manager;
+	MetaBlockPointer table_pointer;
+	vector<LogicalType> types;
+	unique_ptr<PersistentTableData> data;
 };
 
 } // namespace duckdb
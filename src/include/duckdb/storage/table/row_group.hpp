@@ -18,6 +18,7 @@
 #include "duckdb/storage/table/segment_base.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/enums/filter_propagate_result.hpp"
 
 namespace duckdb {
 class AttachedDatabase;
@@ -38,6 +39,7 @@ struct ColumnCheckpointState;
 struct RowGroupPointer;
 struct TransactionData;
 class CollectionScanState;
+class TableFilter;
 class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
@@ -103,9 +105,13 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Asynchronously reads the blocks of the row groups following this one that the scan will need next
+	void ReadAhead(CollectionScanState &state);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(ScanFilterInfo &filters);
+	//! Checks a table filter against the BLOOM indexes on the given column of the table
+	FilterPropagateResult CheckBloomIndexes(idx_t column_index, TableFilter &filter);
 	//! Checks the given set of table filters against the per-segment statistics. Returns false if any segments were
 	//! skipped.
 	bool CheckZonemapSegments(CollectionScanState &state);
@@ -137,6 +143,9 @@ public:
 	idx_t GetCommittedRowCount();
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
+	//! Whether or not the columns of the row group have changed since they were last written to disk. If not, a
+	//! checkpoint does not need to write the row group, but can re-use its existing column data and metadata
+	bool HasChanges() const;
 
 	void InitializeAppend(RowGroupAppendState &append_state);
 	void Append(RowGroupAppendState &append_state, DataChunk &chunk, idx_t append_count);
@@ -183,6 +192,7 @@ private:
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 
 	vector<MetaBlockPointer> CheckpointDeletes(MetadataManager &manager);
+	void CheckpointColumnPointers(MetadataManager &manager, RowGroupPointer &row_group_pointer);
 
 	bool HasUnloadedDeletes() const;
 
@@ -193,6 +203,12 @@ private:
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
 	idx_t allocation_size;
+	//! Whether or not the columns have changed since column_pointers were written
+	atomic<bool> has_changes;
+	//! The metadata blocks holding the column pointers, as far as the columns have been loaded or written
+	vector<MetaBlockPointer> column_metadata_blocks;
+	//! Whether column_metadata_blocks holds the metadata blocks of all columns
+	bool has_metadata_blocks = false;
 };
 
 } // namespace duckdb
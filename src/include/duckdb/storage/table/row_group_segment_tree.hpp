@@ -13,7 +13,7 @@
 
 namespace duckdb {
 struct DataTableInfo;
-class PersistentTableData;
+class PersistentTableDataLoader;
 class MetadataReader;
 
 class RowGroupSegmentTree : public SegmentTree<RowGroup, true> {
@@ -21,7 +21,7 @@ public:
 	explicit RowGroupSegmentTree(RowGroupCollection &collection);
 	~RowGroupSegmentTree() override;
 
-	void Initialize(PersistentTableData &data);
+	void Initialize(shared_ptr<PersistentTableDataLoader> loader);
 
 protected:
 	unique_ptr<RowGroup> LoadSegment() override;
@@ -30,6 +30,8 @@ protected:
 	idx_t current_row_group;
 	idx_t max_row_group;
 	unique_ptr<MetadataReader> reader;
+	//! Set while the row group pointers have not been located yet
+	shared_ptr<PersistentTableDataLoader> loader;
 };
 
 } // namespace duckdb
@@ -109,6 +109,8 @@ struct ColumnFetchState {
 	buffer_handle_set_t handles;
 	//! Any child states of the fetch
 	vector<unique_ptr<ColumnFetchState>> child_states;
+	//! Fetch states of compression methods that are re-used between rows (e.g., decompressed data), keyed by block
+	unordered_map<block_id_t, unique_ptr<SegmentScanState>> segment_states;
 
 	BufferHandle &GetOrInsertHandle(ColumnSegment &segment);
 };
@@ -120,10 +122,17 @@ struct ScanFilter {
 	idx_t table_column_index;
 	TableFilter &filter;
 	bool always_true;
+	//! If the filter contains dynamic filters: a copy of the filter with their current state
+	//! The copy is refreshed for every row group, so that scanning the vectors does not lock the dynamic filters
+	unique_ptr<TableFilter> dynamic_filter_snapshot;
 
 	bool IsAlwaysTrue() const {
 		return always_true;
 	}
+	//! The filter that the scan evaluates
+	TableFilter &GetFilter() const {
+		return dynamic_filter_snapshot ? *dynamic_filter_snapshot : filter;
+	}
 };
 
 class ScanFilterInfo {
@@ -16,7 +16,7 @@
 
 namespace duckdb {
 class ColumnList;
-class PersistentTableData;
+class PersistentTableDataLoader;
 class Serializer;
 class Deserializer;
 
@@ -30,7 +30,8 @@ public:
 
 class TableStatistics {
 public:
-	void Initialize(const vector<LogicalType> &types, PersistentTableData &data);
+	//! Initialize the statistics of a table on disk - these are only read on first access
+	void Initialize(shared_ptr<PersistentTableDataLoader> loader);
 	void InitializeEmpty(const vector<LogicalType> &types);
 
 	void InitializeAddColumn(TableStatistics &parent, const LogicalType &new_column_type);
@@ -54,7 +55,11 @@ public:
 	unique_ptr<TableStatisticsLock> GetLock();
 
 	void Serialize(Serializer &serializer) const;
-	void Deserialize(Deserializer &deserializer, ColumnList &columns);
+	void Deserialize(Deserializer &deserializer, const vector<LogicalType> &types);
+
+private:
+	//! Reads the statistics from disk, if they have not been read yet. Requires the stats lock to be held.
+	void LoadStatistics();
 
 private:
 	//! The statistics lock
@@ -64,6 +69,8 @@ private:
 	//! The table sample
 	//! Sample for table
 	unique_ptr<BlockingSample> table_sample;
+	//! Set while the statistics have not been read from disk yet
+	shared_ptr<PersistentTableDataLoader> loader;
 };
 
 } // namespace duckdb
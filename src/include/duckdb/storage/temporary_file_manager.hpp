@@ -19,6 +19,8 @@
 
 namespace duckdb {
 
+enum class TemporaryFileCompression : uint8_t;
+
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
@@ -27,7 +29,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -38,6 +40,8 @@ public:
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
 	bool HasFreeBlocks();
+	//! The number of block indexes that are currently in use
+	idx_t GetUsedBlockCount();
 
 private:
 	void SetMaxIndex(idx_t blocks);
@@ -48,6 +52,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size of a block on disk, used to register the size of the temporary file with the manager
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -66,6 +72,38 @@ public:
 	bool IsValid() const;
 };
 
+//===--------------------------------------------------------------------===//
+// TemporaryBufferCompression
+//===--------------------------------------------------------------------===//
+
+//! The codec a block was compressed with before it was written to a temporary file
+enum class TemporaryBufferCodec : uint8_t { UNCOMPRESSED = 0, LZ4 = 1, ZSTD = 2 };
+
+//! A compressed block, ready to be written to a temporary file
+struct CompressedTemporaryBuffer {
+	//! Compressed blocks are stored as [codec][compressed size][compressed data]
+	static constexpr idx_t HEADER_SIZE = 2 * sizeof(idx_t);
+	//! Compressed blocks are stored in slots that are a multiple of 1/SIZE_CLASS_COUNT of the block allocation size
+	static constexpr idx_t SIZE_CLASS_COUNT = 8;
+
+	TemporaryBufferCodec codec = TemporaryBufferCodec::UNCOMPRESSED;
+	//! The compressed block, including the header (points into scratch space of the compressing thread)
+	data_ptr_t data = nullptr;
+	//! The size of the compressed block, including the header
+	idx_t size = 0;
+	//! The size of the space that "data" points to
+	idx_t capacity = 0;
+
+public:
+	//! Compresses the buffer using "compression" - returns an UNCOMPRESSED buffer if compressing is not worthwhile
+	//! The result is only valid until the same thread compresses the next buffer
+	static CompressedTemporaryBuffer Compress(FileBuffer &buffer, TemporaryFileCompression compression);
+	//! Decompresses a compressed block read from a temporary file into the buffer
+	static void Decompress(const_data_ptr_t compressed, idx_t slot_size, FileBuffer &buffer);
+	//! Returns the size of the slot that a compressed block of "size" bytes is stored in (or 0 if it does not fit)
+	static idx_t GetSlotSize(idx_t size, idx_t block_alloc_size);
+};
+
 //===--------------------------------------------------------------------===//
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
@@ -75,7 +113,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    TemporaryFileManager &manager, idx_t slot_size);
 
 public:
 	struct TemporaryFileLock {
@@ -89,7 +127,10 @@ public:
 public:
 	TemporaryFileIndex TryGetBlockIndex();
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	void WriteTemporaryFile(CompressedTemporaryBuffer &buffer, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! The size of the slots in this file - smaller than the block allocation size if the blocks are compressed
+	idx_t GetSlotSize() const;
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
@@ -98,10 +139,13 @@ private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
 	void RemoveTempBlockIndex(TemporaryFileLock &, idx_t index);
 	idx_t GetPositionInFile(idx_t index);
+	bool IsCompressed() const;
 
 private:
 	const idx_t max_allowed_index;
 	DatabaseInstance &db;
+	//! The size of the slots in this file
+	const idx_t slot_size;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
 	string path;
@@ -110,7 +110,14 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and sync the WAL to disk
 	void Flush();
+	//! Write a flush marker, without syncing the WAL to disk - the entries only become durable after the next Sync
+	void WriteFlush();
+	//! Write all buffered entries to the WAL file, without syncing the file to disk
+	void FlushBuffer();
+	//! Sync all entries that have been written to the WAL file to disk
+	void Sync();
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
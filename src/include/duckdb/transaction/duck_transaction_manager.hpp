@@ -12,6 +12,8 @@
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class DuckTransaction;
 
@@ -77,6 +79,10 @@ private:
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction, bool store_transaction) noexcept;
 
+	//! Waits until the WAL entries of the given commit are synced to disk. Concurrent commits are grouped: one of
+	//! them syncs the WAL on behalf of all commits written so far, while the others wait for it to finish
+	ErrorData SyncWAL(idx_t commit_sequence) noexcept;
+
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
@@ -106,6 +112,20 @@ private:
 	mutex start_transaction_lock;
 	//! Mutex used to control writes to the WAL - separate from the transaction lock
 	mutex wal_lock;
+	//! The number of commits that have been written to the WAL (protected by the WAL lock)
+	atomic<idx_t> written_commits = {0};
+	//! Lock protecting the group commit state below
+	mutex group_commit_lock;
+	//! Signalled when a WAL sync finishes - commits that wait for their WAL entries to be synced wait on this
+	std::condition_variable group_commit_cv;
+	//! Signalled when a commit joins an active WAL sync - only the commit that performs the sync waits on this
+	std::condition_variable group_leader_cv;
+	//! The number of commits of which the WAL entries are synced to disk
+	idx_t synced_commits = 0;
+	//! Whether a commit is currently syncing the WAL on behalf of the others
+	bool wal_sync_active = false;
+	//! The error of a failed WAL sync - all subsequent commits fail, as the database is invalidated
+	ErrorData wal_sync_error;
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
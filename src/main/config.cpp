@@ -70,6 +70,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(DefaultNullOrderSetting),
     DUCKDB_GLOBAL(DisabledFileSystemsSetting),
     DUCKDB_GLOBAL(DisabledOptimizersSetting),
+    DUCKDB_LOCAL(DynamicInFilterThreshold),
     DUCKDB_GLOBAL(EnableExternalAccessSetting),
     DUCKDB_GLOBAL(EnableFSSTVectors),
     DUCKDB_GLOBAL(AllowUnsignedExtensionsSetting),
@@ -120,11 +121,14 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL_ALIAS("profiling_output", ProfileOutputSetting),
     DUCKDB_LOCAL(CustomProfilingSettings),
     DUCKDB_LOCAL(ProgressBarTimeSetting),
+    DUCKDB_GLOBAL(SchedulerModeSetting),
     DUCKDB_LOCAL(SchemaSetting),
     DUCKDB_LOCAL(SearchPathSetting),
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
+    DUCKDB_GLOBAL(StorageReadAheadSetting),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
@@ -132,6 +136,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(ProduceArrowStringView),
     DUCKDB_GLOBAL_ALIAS("user", UsernameSetting),
     DUCKDB_GLOBAL_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(WALGroupCommitDelaySetting),
+    DUCKDB_GLOBAL(WALGroupCommitSizeSetting),
     DUCKDB_GLOBAL_ALIAS("worker_threads", ThreadsSetting),
     DUCKDB_GLOBAL(FlushAllocatorSetting),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
@@ -5,6 +5,54 @@
 
 namespace duckdb {
 
+bool SettingSetFunctions::IsOperatorMetric(const MetricsType setting) {
+	switch (setting) {
+	case MetricsType::CPU_TIME:
+	case MetricsType::EXTRA_INFO:
+	case MetricsType::OPERATOR_CARDINALITY:
+	case MetricsType::OPERATOR_TIMING:
+		return false;
+	default:
+		return true;
+	}
+}
+
+bool SettingSetFunctions::OperatorMetricsEnabled(const profiler_settings_t &settings) {
+	for (auto &setting : settings) {
+		if (IsOperatorMetric(setting)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//! The operator metrics are collected by components that have no access to the operator (e.g., the buffer manager)
+//! Instead, the OperatorProfiler registers the metrics of the active operator for the thread that executes it
+static thread_local OperatorMetrics *active_operator_metrics = nullptr;
+
+void OperatorMetrics::Add(const OperatorMetrics &other) {
+	bytes_read += other.bytes_read;
+	bytes_written += other.bytes_written;
+	rows_filtered += other.rows_filtered;
+	row_groups_skipped += other.row_groups_skipped;
+	segments_skipped += other.segments_skipped;
+	hash_table_size += other.hash_table_size;
+	hash_table_resizes += other.hash_table_resizes;
+	spill_bytes += other.spill_bytes;
+	buffer_pins += other.buffer_pins;
+	buffer_evictions += other.buffer_evictions;
+	io_wait_time += other.io_wait_time;
+	scheduler_wait_time += other.scheduler_wait_time;
+}
+
+optional_ptr<OperatorMetrics> OperatorMetrics::Active() {
+	return active_operator_metrics;
+}
+
+void OperatorMetrics::SetActive(optional_ptr<OperatorMetrics> metrics) {
+	active_operator_metrics = metrics.get();
+}
+
 void ProfilingInfo::SetSettings(profiler_settings_t const &n_settings) {
 	this->settings = n_settings;
 }
@@ -51,6 +99,30 @@ string ProfilingInfo::GetMetricAsString(MetricsType setting) const {
 		return to_string(metrics.operator_cardinality);
 	case MetricsType::OPERATOR_TIMING:
 		return to_string(metrics.operator_timing);
+	case MetricsType::BYTES_READ:
+		return to_string(metrics.operator_metrics.bytes_read);
+	case MetricsType::BYTES_WRITTEN:
+		return to_string(metrics.operator_metrics.bytes_written);
+	case MetricsType::ROWS_FILTERED:
+		return to_string(metrics.operator_metrics.rows_filtered);
+	case MetricsType::ROW_GROUPS_SKIPPED:
+		return to_string(metrics.operator_metrics.row_groups_skipped);
+	case MetricsType::SEGMENTS_SKIPPED:
+		return to_string(metrics.operator_metrics.segments_skipped);
+	case MetricsType::HASH_TABLE_SIZE:
+		return to_string(metrics.operator_metrics.hash_table_size);
+	case MetricsType::HASH_TABLE_RESIZES:
+		return to_string(metrics.operator_metrics.hash_table_resizes);
+	case MetricsType::SPILL_BYTES:
+		return to_string(metrics.operator_metrics.spill_bytes);
+	case MetricsType::BUFFER_PINS:
+		return to_string(metrics.operator_metrics.buffer_pins);
+	case MetricsType::BUFFER_EVICTIONS:
+		return to_string(metrics.operator_metrics.buffer_evictions);
+	case MetricsType::IO_WAIT_TIME:
+		return to_string(metrics.operator_metrics.io_wait_time);
+	case MetricsType::SCHEDULER_WAIT_TIME:
+		return to_string(metrics.operator_metrics.scheduler_wait_time);
 	}
 	return "";
 }
@@ -245,6 +245,7 @@ void QueryProfiler::EndPhase() {
 OperatorProfiler::OperatorProfiler(ClientContext &context) {
 	enabled = QueryProfiler::Get(context).IsEnabled();
 	settings = ClientConfig::GetConfig(context).profiler_settings;
+	operator_metrics_enabled = enabled && SettingSetFunctions::OperatorMetricsEnabled(settings);
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -257,6 +258,9 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 	}
 
 	active_operator = phys_op;
+	if (operator_metrics_enabled) {
+		OperatorMetrics::SetActive(GetOperatorInfo(*active_operator).metrics);
+	}
 
 	// start timing for current element
 	if (SettingEnabled(MetricsType::OPERATOR_TIMING)) {
@@ -288,6 +292,9 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 			curr_operator_info.AddElements(chunk->size());
 		}
 	}
+	if (operator_metrics_enabled) {
+		OperatorMetrics::SetActive(nullptr);
+	}
 	active_operator = nullptr;
 }
 
@@ -302,6 +309,13 @@ OperatorInformation &OperatorProfiler::GetOperatorInfo(const PhysicalOperator &p
 	}
 }
 
+optional_ptr<OperatorMetrics> OperatorProfiler::GetOperatorMetrics(const PhysicalOperator &phys_op) {
+	if (!operator_metrics_enabled) {
+		return nullptr;
+	}
+	return GetOperatorInfo(phys_op).metrics;
+}
+
 void OperatorProfiler::Flush(const PhysicalOperator &phys_op, ExpressionExecutor &expression_executor,
                              const string &name, int id) {
 	auto entry = timings.find(phys_op);
@@ -329,6 +343,9 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 		if (profiler.SettingEnabled(MetricsType::OPERATOR_CARDINALITY)) {
 			tree_node.GetProfilingInfo().metrics.operator_cardinality += node.second.elements;
 		}
+		if (profiler.operator_metrics_enabled) {
+			tree_node.GetProfilingInfo().metrics.operator_metrics.Add(node.second.metrics);
+		}
 	}
 	profiler.timings.clear();
 }
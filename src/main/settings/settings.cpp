@@ -414,6 +414,23 @@ Value DisabledOptimizersSetting::GetSetting(const ClientContext &context) {
 	return Value(result);
 }
 
+//===--------------------------------------------------------------------===//
+// Dynamic In Filter Threshold
+//===--------------------------------------------------------------------===//
+void DynamicInFilterThreshold::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.dynamic_in_filter_threshold = input.GetValue<idx_t>();
+}
+
+void DynamicInFilterThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).dynamic_in_filter_threshold = ClientConfig().dynamic_in_filter_threshold;
+}
+
+Value DynamicInFilterThreshold::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::UBIGINT(config.dynamic_in_filter_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Enable External Access
 //===--------------------------------------------------------------------===//
@@ -1559,6 +1576,39 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Scheduler Mode
+//===--------------------------------------------------------------------===//
+void SchedulerModeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto mode = StringUtil::Lower(input.ToString());
+	if (mode == "global_queue") {
+		config.options.scheduler_mode = TaskSchedulerMode::GLOBAL_QUEUE;
+	} else if (mode == "work_stealing") {
+		config.options.scheduler_mode = TaskSchedulerMode::WORK_STEALING;
+	} else if (mode == "numa_work_stealing") {
+		config.options.scheduler_mode = TaskSchedulerMode::NUMA_WORK_STEALING;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized option for scheduler_mode \"%s\", expected global_queue, work_stealing or numa_work_stealing",
+		    mode);
+	}
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetSchedulerMode(config.options.scheduler_mode);
+	}
+}
+
+void SchedulerModeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.scheduler_mode = DBConfig().options.scheduler_mode;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetSchedulerMode(config.options.scheduler_mode);
+	}
+}
+
+Value SchedulerModeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.scheduler_mode)));
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1616,6 +1666,22 @@ Value SecretDirectorySetting::GetSetting(const ClientContext &context) {
 	return config.secret_manager->PersistentSecretPath();
 }
 
+//===--------------------------------------------------------------------===//
+// Storage Read Ahead
+//===--------------------------------------------------------------------===//
+void StorageReadAheadSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.storage_read_ahead = input.GetValue<uint64_t>();
+}
+
+void StorageReadAheadSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.storage_read_ahead = DBConfig().options.storage_read_ahead;
+}
+
+Value StorageReadAheadSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.storage_read_ahead);
+}
+
 //===--------------------------------------------------------------------===//
 // Temp Directory
 //===--------------------------------------------------------------------===//
@@ -1643,6 +1709,34 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto compression = StringUtil::Lower(input.ToString());
+	if (compression == "none") {
+		config.options.temp_file_compression = TemporaryFileCompression::NONE;
+	} else if (compression == "lz4") {
+		config.options.temp_file_compression = TemporaryFileCompression::LZ4;
+	} else if (compression == "zstd") {
+		config.options.temp_file_compression = TemporaryFileCompression::ZSTD;
+	} else if (compression == "adaptive") {
+		config.options.temp_file_compression = TemporaryFileCompression::ADAPTIVE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized option for temp_file_compression \"%s\", expected none, lz4, zstd or adaptive", compression);
+	}
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(StringUtil::Lower(EnumUtil::ToString(config.options.temp_file_compression)));
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1686,6 +1780,42 @@ Value UsernameSetting::GetSetting(const ClientContext &context) {
 	return Value();
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Delay
+//===--------------------------------------------------------------------===//
+void WALGroupCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_delay = input.GetValue<uint64_t>();
+}
+
+void WALGroupCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_delay = DBConfig().options.wal_group_commit_delay;
+}
+
+Value WALGroupCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_delay);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Size
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSizeSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto group_commit_size = input.GetValue<uint64_t>();
+	if (group_commit_size == 0) {
+		throw InvalidInputException("wal_group_commit_size must be at least 1");
+	}
+	config.options.wal_group_commit_size = group_commit_size;
+}
+
+void WALGroupCommitSizeSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_size = DBConfig().options.wal_group_commit_size;
+}
+
+Value WALGroupCommitSizeSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_size);
+}
+
 //===--------------------------------------------------------------------===//
 // Allocator Flush Threshold
 //===--------------------------------------------------------------------===//
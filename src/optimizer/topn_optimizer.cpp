@@ -1,8 +1,12 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -32,6 +36,96 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool SupportsDynamicFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// the rows that do not beat the current boundary of the first ORDER BY column can never enter the Top-N
+	auto &order = op.orders[0];
+	if (order.null_order == OrderByNullType::NULLS_FIRST) {
+		// NULL values always beat the boundary - they would be removed by a comparison filter
+		return;
+	}
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF ||
+	    !SupportsDynamicFilter(order.expression->return_type)) {
+		return;
+	}
+	// find the LogicalGet the column originates from
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> child(*op.children[0]);
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		switch (child.get().type) {
+		case LogicalOperatorType::LOGICAL_FILTER:
+			// filters do not change the values of the column - continue into the child
+			break;
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = child.get().Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = *proj.expressions[binding.column_index];
+			if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+				// not a simple column ref - bail-out
+				return;
+			}
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			break;
+		}
+		default:
+			return;
+		}
+		child = *child.get().children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (binding.table_index != get.table_index || !get.function.filter_pushdown) {
+		return;
+	}
+	// the bindings of a LogicalGet refer to its column ids, also when some of the columns are projected out
+	auto column_index = binding.column_index;
+	auto &column_ids = get.GetColumnIds();
+	if (column_index >= column_ids.size() || IsRowIdColumnId(column_ids[column_index])) {
+		return;
+	}
+	auto column_id = column_ids[column_index];
+	if (column_id >= get.returned_types.size() || get.returned_types[column_id] != order.expression->return_type) {
+		return;
+	}
+
+	// the filter is inclusive: rows equal to the boundary can still enter the Top-N through the other ORDER BY columns
+	auto comparison_type = order.type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+	                                                          : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	auto filter_data = make_shared_ptr<DynamicFilterData>();
+	filter_data->filter = make_uniq<ConstantFilter>(comparison_type, Value(order.expression->return_type));
+	get.table_filters.PushFilter(column_id, make_uniq<DynamicFilter>(filter_data));
+	op.dynamic_filter = std::move(filter_data);
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -62,6 +156,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 		}
 		auto topn = make_uniq<LogicalTopN>(std::move(order_by.orders), limit_val, offset_val);
 		topn->AddChild(std::move(order_by.children[0]));
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
@@ -1,6 +1,7 @@
 #include "duckdb/parallel/task.hpp"
 #include "duckdb/execution/executor.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/profiling_info.hpp"
 
 namespace duckdb {
 
@@ -35,6 +36,8 @@ TaskExecutionResult ExecutorTask::Execute(TaskExecutionMode mode) {
 	} catch (...) { // LCOV_EXCL_START
 		executor.PushError(ErrorData("Unknown exception in Finalize!"));
 	} // LCOV_EXCL_STOP
+	// the operator that threw did not end, so its metrics are still registered for this thread
+	OperatorMetrics::SetActive(nullptr);
 	return TaskExecutionResult::TASK_ERROR;
 }
 
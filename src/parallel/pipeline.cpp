@@ -17,6 +17,7 @@ namespace duckdb {
 
 PipelineTask::PipelineTask(Pipeline &pipeline_p, shared_ptr<Event> event_p)
     : ExecutorTask(pipeline_p.executor, std::move(event_p)), pipeline(pipeline_p) {
+	scheduler_wait.Start();
 }
 
 bool PipelineTask::TaskBlockedOnResult() const {
@@ -33,6 +34,8 @@ TaskExecutionResult PipelineTask::ExecuteTask(TaskExecutionMode mode) {
 	if (!pipeline_executor) {
 		pipeline_executor = make_uniq<PipelineExecutor>(pipeline.GetClientContext(), pipeline);
 	}
+	scheduler_wait.End();
+	pipeline_executor->AddSchedulerWaitTime(scheduler_wait.Elapsed());
 
 	pipeline_executor->SetTaskForInterrupts(shared_from_this());
 
@@ -41,8 +44,10 @@ TaskExecutionResult PipelineTask::ExecuteTask(TaskExecutionMode mode) {
 
 		switch (res) {
 		case PipelineExecuteResult::NOT_FINISHED:
+			scheduler_wait.Start();
 			return TaskExecutionResult::TASK_NOT_FINISHED;
 		case PipelineExecuteResult::INTERRUPTED:
+			scheduler_wait.Start();
 			return TaskExecutionResult::TASK_BLOCKED;
 		case PipelineExecuteResult::FINISHED:
 			break;
@@ -53,6 +58,7 @@ TaskExecutionResult PipelineTask::ExecuteTask(TaskExecutionMode mode) {
 		case PipelineExecuteResult::NOT_FINISHED:
 			throw InternalException("Execute without limit should not return NOT_FINISHED");
 		case PipelineExecuteResult::INTERRUPTED:
+			scheduler_wait.Start();
 			return TaskExecutionResult::TASK_BLOCKED;
 		case PipelineExecuteResult::FINISHED:
 			break;
@@ -23,7 +23,10 @@ PipelineExecutor::PipelineExecutor(ClientContext &context_p, Pipeline &pipeline_
 			partition_info.min_batch_index = partition_info.batch_index;
 		}
 	}
+	// initializing the local source state can already scan data (e.g., claim the first row group of a table scan)
+	OperatorMetrics::SetActive(context.thread.profiler.GetOperatorMetrics(*pipeline.source));
 	local_source_state = pipeline.source->GetLocalSourceState(context, *pipeline.source_state);
+	OperatorMetrics::SetActive(nullptr);
 
 	intermediate_chunks.reserve(pipeline.operators.size());
 	intermediate_states.reserve(pipeline.operators.size());
@@ -446,6 +449,13 @@ void PipelineExecutor::SetTaskForInterrupts(weak_ptr<Task> current_task) {
 	interrupt_state = InterruptState(std::move(current_task));
 }
 
+void PipelineExecutor::AddSchedulerWaitTime(double wait_time) {
+	auto metrics = context.thread.profiler.GetOperatorMetrics(*pipeline.source);
+	if (metrics) {
+		metrics->scheduler_wait_time += wait_time;
+	}
+}
+
 SourceResultType PipelineExecutor::GetData(DataChunk &chunk, OperatorSourceInput &input) {
 	//! Testing feature to enable async source on every operator
 #ifdef DUCKDB_DEBUG_ASYNC_SINK_SOURCE
@@ -1,8 +1,11 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -23,6 +26,11 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#define DUCKDB_NUMA_PINNING
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -38,37 +46,338 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The tasks of a single producer that were scheduled on a CPU in one of the work stealing modes
+struct ProducerTaskDeque {
+	//! The amount of tasks of the producer in all deques (shared, as the tasks can outlive the producer)
+	shared_ptr<atomic<idx_t>> producer_task_count;
+	deque<shared_ptr<Task>> tasks;
+};
+typedef unordered_map<const atomic<idx_t> *, ProducerTaskDeque> producer_deque_map_t;
+
+//! The tasks scheduled on a single CPU in the work stealing modes, with a separate deque per producer. The CPU
+//! pushes and pops tasks at the back (the most recently scheduled task is the most likely to still have its data in
+//! the cache), other CPUs steal tasks from the front.
+struct CPUTaskDeque {
+	mutex lock;
+	//! The deques of the producers that have tasks on this CPU, keyed by their task count, which outlives the producer
+	producer_deque_map_t producers;
+	//! The producer that most recently scheduled a task on this CPU
+	const atomic<idx_t> *last_producer = nullptr;
+};
+
 struct ConcurrentQueue {
+	explicit ConcurrentQueue(TaskSchedulerMode mode);
+
 	concurrent_queue_t q;
 	lightweight_semaphore_t semaphore;
+	//! Determines whether new tasks are enqueued in the global queue or in the per-CPU deques
+	atomic<TaskSchedulerMode> mode;
+	//! The per-CPU deques used in the work stealing modes (fixed after construction)
+	vector<unique_ptr<CPUTaskDeque>> deques;
+	//! The amount of tasks in the per-CPU deques
+	atomic<idx_t> deque_task_count;
+	//! The NUMA node of every CPU, and the CPUs of every NUMA node
+	vector<idx_t> cpu_nodes;
+	vector<vector<idx_t>> node_cpus;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	bool Dequeue(shared_ptr<Task> &task);
+	//! Pins a worker thread to the CPUs of a NUMA node (if there are multiple NUMA nodes)
+	void PinThread(thread &worker_thread, idx_t thread_idx);
+
+private:
+	bool DequeueFromDeques(shared_ptr<Task> &task);
+	bool StealFrom(idx_t cpu, shared_ptr<Task> &task);
+	bool DequeueFromProducerDeque(CPUTaskDeque &cpu_deque, const ProducerToken &token, shared_ptr<Task> &task,
+	                              bool try_lock);
+	bool PopTask(CPUTaskDeque &cpu_deque, bool from_back, shared_ptr<Task> &task);
+	void TakeTask(CPUTaskDeque &cpu_deque, producer_deque_map_t::iterator entry, bool from_back,
+	              shared_ptr<Task> &task);
+	void DetectNUMATopology();
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue)
+	    : queue_token(queue.q), deque_task_count(make_shared_ptr<atomic<idx_t>>(0)) {
 	}
 
 	duckdb_moodycamel::ProducerToken queue_token;
+	//! The amount of tasks of this producer in the per-CPU deques
+	shared_ptr<atomic<idx_t>> deque_task_count;
 };
 
+//! The amount of random victims an idle thread tries to steal from before giving up
+static constexpr idx_t STEAL_ATTEMPTS = 8;
+
+//! Picks a random CPU to steal from - every thread has its own generator, so stealing threads do not contend on it
+static idx_t RandomVictim(idx_t cpu_count) {
+	static thread_local uint64_t state = 0;
+	if (state == 0) {
+		state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+	}
+	// xorshift64
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	return state % cpu_count;
+}
+
+ConcurrentQueue::ConcurrentQueue(TaskSchedulerMode mode) : mode(mode), deque_task_count(0) {
+	DetectNUMATopology();
+	for (idx_t cpu = 0; cpu < cpu_nodes.size(); cpu++) {
+		deques.push_back(make_uniq<CPUTaskDeque>());
+	}
+}
+
+static bool ParseCPUList(const string &cpu_list, vector<idx_t> &result) {
+	// the cpulist has the format "0-3,8-11"
+	for (auto &range : StringUtil::Split(cpu_list, ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		if (bounds.empty() || bounds.size() > 2) {
+			return false;
+		}
+		char *end;
+		auto start = std::strtoull(bounds[0].c_str(), &end, 10);
+		auto last = bounds.size() == 2 ? std::strtoull(bounds[1].c_str(), &end, 10) : start;
+		for (auto cpu = start; cpu <= last; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return true;
+}
+
+void ConcurrentQueue::DetectNUMATopology() {
+	idx_t cpu_count = MaxValue<idx_t>(std::thread::hardware_concurrency(), 1);
+#ifdef DUCKDB_NUMA_PINNING
+	auto fs = FileSystem::CreateLocal();
+	for (idx_t node = 0;; node++) {
+		auto path = StringUtil::Format("/sys/devices/system/node/node%llu/cpulist", node);
+		if (!fs->FileExists(path)) {
+			break;
+		}
+		char byte_buffer[4096];
+		auto handle = fs->OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		auto read_bytes = fs->Read(*handle, (void *)byte_buffer, sizeof(byte_buffer) - 1);
+		byte_buffer[read_bytes] = '\0';
+		vector<idx_t> cpus;
+		if (!ParseCPUList(StringUtil::Replace(string(byte_buffer), "\n", ""), cpus)) {
+			node_cpus.clear();
+			break;
+		}
+		for (auto cpu : cpus) {
+			cpu_count = MaxValue<idx_t>(cpu_count, cpu + 1);
+		}
+		node_cpus.push_back(std::move(cpus));
+	}
+#endif
+	cpu_nodes.resize(cpu_count, 0);
+	if (node_cpus.empty()) {
+		// unknown topology - treat all CPUs as a single node
+		node_cpus.emplace_back();
+		for (idx_t cpu = 0; cpu < cpu_count; cpu++) {
+			node_cpus[0].push_back(cpu);
+		}
+		return;
+	}
+	for (idx_t node = 0; node < node_cpus.size(); node++) {
+		for (auto cpu : node_cpus[node]) {
+			cpu_nodes[cpu] = node;
+		}
+	}
+}
+
+void ConcurrentQueue::PinThread(thread &worker_thread, idx_t thread_idx) {
+#ifdef DUCKDB_NUMA_PINNING
+	if (node_cpus.size() <= 1) {
+		// a single NUMA node - nothing to pin
+		return;
+	}
+	// distribute the threads over the nodes round-robin
+	auto &cpus = node_cpus[thread_idx % node_cpus.size()];
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto cpu : cpus) {
+		CPU_SET(cpu, &cpu_set);
+	}
+	// pinning is best-effort: if it fails, the thread can run on any CPU
+	pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
-		semaphore.signal();
+	if (mode == TaskSchedulerMode::GLOBAL_QUEUE) {
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		if (q.enqueue(token.token->queue_token, std::move(task))) {
+			semaphore.signal();
+		} else {
+			throw InternalException("Could not schedule task!");
+		}
+		return;
+	}
+	// tasks scheduled by a thread usually operate on data that thread just touched: push them on the deque of its CPU
+	auto &cpu_deque = *deques[TaskScheduler::GetEstimatedCPUId() % deques.size()];
+	auto &producer_task_count = token.token->deque_task_count;
+	{
+		lock_guard<mutex> deque_lock(cpu_deque.lock);
+		// the counts are incremented before the task can be taken, so they never drop below the amount of tasks
+		++(*producer_task_count);
+		++deque_task_count;
+		auto &producer_tasks = cpu_deque.producers[producer_task_count.get()];
+		if (!producer_tasks.producer_task_count) {
+			producer_tasks.producer_task_count = producer_task_count;
+		}
+		producer_tasks.tasks.push_back(std::move(task));
+		cpu_deque.last_producer = producer_task_count.get();
+	}
+	semaphore.signal();
+}
+
+void ConcurrentQueue::TakeTask(CPUTaskDeque &cpu_deque, producer_deque_map_t::iterator entry, bool from_back,
+                               shared_ptr<Task> &task) {
+	auto &producer_tasks = entry->second;
+	D_ASSERT(!producer_tasks.tasks.empty());
+	if (from_back) {
+		task = std::move(producer_tasks.tasks.back());
+		producer_tasks.tasks.pop_back();
+	} else {
+		task = std::move(producer_tasks.tasks.front());
+		producer_tasks.tasks.pop_front();
+	}
+	--(*producer_tasks.producer_task_count);
+	--deque_task_count;
+	if (producer_tasks.tasks.empty()) {
+		// only producers with tasks are kept, so that any entry can be taken from
+		if (cpu_deque.last_producer == entry->first) {
+			cpu_deque.last_producer = nullptr;
+		}
+		cpu_deque.producers.erase(entry);
+	}
+}
+
+bool ConcurrentQueue::DequeueFromProducerDeque(CPUTaskDeque &cpu_deque, const ProducerToken &token,
+                                               shared_ptr<Task> &task, bool try_lock) {
+	unique_lock<mutex> deque_lock(cpu_deque.lock, std::defer_lock);
+	if (try_lock) {
+		if (!deque_lock.try_lock()) {
+			return false;
+		}
 	} else {
-		throw InternalException("Could not schedule task!");
+		deque_lock.lock();
 	}
+	auto entry = cpu_deque.producers.find(token.token->deque_task_count.get());
+	if (entry == cpu_deque.producers.end()) {
+		return false;
+	}
+	// the most recently scheduled task of the producer is at the back
+	TakeTask(cpu_deque, entry, true, task);
+	return true;
 }
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	{
+		lock_guard<mutex> producer_lock(token.producer_lock);
+		if (q.try_dequeue_from_producer(token.token->queue_token, task)) {
+			return true;
+		}
+	}
+	auto &producer_task_count = *token.token->deque_task_count;
+	if (producer_task_count == 0) {
+		return false;
+	}
+	// the tasks of a producer are usually scheduled by the thread that executes them: look at our own CPU first
+	auto cpu = TaskScheduler::GetEstimatedCPUId() % deques.size();
+	if (DequeueFromProducerDeque(*deques[cpu], token, task, false)) {
+		return true;
+	}
+	// then look at random other CPUs, skipping the deques that are in use
+	for (idx_t attempt = 0; attempt < STEAL_ATTEMPTS && producer_task_count > 0; attempt++) {
+		if (DequeueFromProducerDeque(*deques[RandomVictim(deques.size())], token, task, true)) {
+			return true;
+		}
+	}
+	// the producer still has tasks in the deques - look at all of them, as there might not be any worker threads
+	for (idx_t i = 0; i < deques.size() && producer_task_count > 0; i++) {
+		if (DequeueFromProducerDeque(*deques[i], token, task, false)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task) {
+	// tasks can be in both the global queue and the deques (e.g. after changing the scheduler mode)
+	if (mode == TaskSchedulerMode::GLOBAL_QUEUE) {
+		return q.try_dequeue(task) || DequeueFromDeques(task);
+	}
+	return DequeueFromDeques(task) || q.try_dequeue(task);
+}
+
+bool ConcurrentQueue::StealFrom(idx_t cpu, shared_ptr<Task> &task) {
+	auto &cpu_deque = *deques[cpu];
+	unique_lock<mutex> deque_lock(cpu_deque.lock, std::try_to_lock);
+	if (!deque_lock.owns_lock() || cpu_deque.producers.empty()) {
+		// the deque is in use - try another victim instead of waiting for it
+		return false;
+	}
+	// steal the oldest task of any producer
+	TakeTask(cpu_deque, cpu_deque.producers.begin(), false, task);
+	return true;
+}
+
+bool ConcurrentQueue::PopTask(CPUTaskDeque &cpu_deque, bool from_back, shared_ptr<Task> &task) {
+	lock_guard<mutex> deque_lock(cpu_deque.lock);
+	if (cpu_deque.producers.empty()) {
+		return false;
+	}
+	auto entry = cpu_deque.producers.begin();
+	if (from_back && cpu_deque.last_producer) {
+		// the most recently scheduled task belongs to the producer that scheduled last
+		entry = cpu_deque.producers.find(cpu_deque.last_producer);
+		D_ASSERT(entry != cpu_deque.producers.end());
+	}
+	TakeTask(cpu_deque, entry, from_back, task);
+	return true;
+}
+
+bool ConcurrentQueue::DequeueFromDeques(shared_ptr<Task> &task) {
+	if (deque_task_count == 0) {
+		return false;
+	}
+	// first take the most recently scheduled task of our own CPU
+	auto cpu = TaskScheduler::GetEstimatedCPUId() % deques.size();
+	if (PopTask(*deques[cpu], true, task)) {
+		return true;
+	}
+	// then steal from random CPUs on our own NUMA node, so the data of the task is likely in local memory
+	auto &local_cpus = node_cpus[cpu_nodes[cpu]];
+	for (idx_t attempt = 0; attempt < STEAL_ATTEMPTS && deque_task_count > 0; attempt++) {
+		auto victim = local_cpus[RandomVictim(local_cpus.size())];
+		if (victim != cpu && StealFrom(victim, task)) {
+			return true;
+		}
+	}
+	// then steal from random CPUs on any NUMA node
+	for (idx_t attempt = 0; attempt < STEAL_ATTEMPTS && deque_task_count > 0; attempt++) {
+		auto victim = RandomVictim(deques.size());
+		if (victim != cpu && StealFrom(victim, task)) {
+			return true;
+		}
+	}
+	// finally look at all deques, so that the remaining tasks are not left behind
+	for (idx_t victim = 0; victim < deques.size() && deque_task_count > 0; victim++) {
+		if (victim != cpu && PopTask(*deques[victim], false, task)) {
+			return true;
+		}
+	}
+	return false;
 }
 
 #else
 struct ConcurrentQueue {
+	explicit ConcurrentQueue(TaskSchedulerMode mode) {
+	}
+
 	std::queue<shared_ptr<Task>> q;
 	mutex qlock;
 
@@ -105,10 +414,10 @@ ProducerToken::~ProducerToken() {
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), queue(make_uniq<ConcurrentQueue>(db.config.options.scheduler_mode)),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), relaunch_required(false) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -164,7 +473,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				queue->semaphore.wait();
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(task)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -197,7 +506,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -227,7 +536,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task)) {
 			return;
 		}
 		try {
@@ -336,9 +645,25 @@ idx_t TaskScheduler::GetEstimatedCPUId() {
 void TaskScheduler::RelaunchThreads() {
 	lock_guard<mutex> t(thread_lock);
 	auto n = requested_thread_count.load();
+	if (relaunch_required) {
+		// stop all threads, so that they are relaunched with the new settings
+		relaunch_required = false;
+		RelaunchThreadsInternal(0);
+	}
 	RelaunchThreadsInternal(n);
 }
 
+void TaskScheduler::SetSchedulerMode(TaskSchedulerMode mode) {
+#ifndef DUCKDB_NO_THREADS
+	auto old_mode = queue->mode.exchange(mode);
+	if ((old_mode == TaskSchedulerMode::NUMA_WORK_STEALING) != (mode == TaskSchedulerMode::NUMA_WORK_STEALING)) {
+		// the threads are (un)pinned when they are launched - we cannot relaunch them here, as we might be running in
+		// one of them
+		relaunch_required = true;
+	}
+#endif
+}
+
 void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
@@ -375,6 +700,9 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
+			if (queue->mode == TaskSchedulerMode::NUMA_WORK_STEALING) {
+				queue->PinThread(*worker_thread, threads.size());
+			}
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
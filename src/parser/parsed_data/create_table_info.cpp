@@ -26,6 +26,7 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->order_by = order_by;
 	return std::move(result);
 }
 
@@ -49,7 +50,8 @@ string CreateTableInfo::ToString() const {
 	if (query != nullptr) {
 		ret += " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints);
+		ret += TableCatalogEntry::OrderByToSQL(order_by) + ";";
 	}
 	return ret;
 }
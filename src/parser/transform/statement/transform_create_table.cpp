@@ -124,6 +124,29 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 		throw ParserException("Table must have at least one column!");
 	}
 
+	if (stmt.options) {
+		for (auto option = stmt.options->head; option != nullptr; option = lnext(option)) {
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(option->data.ptr_value);
+			if (!def_elem->defname || StringUtil::Lower(def_elem->defname) != "order_by") {
+				// other storage options are accepted for compatibility, but ignored
+				continue;
+			}
+			auto value = PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+			if (!value || value->type != duckdb_libpgquery::T_PGString) {
+				throw ParserException("The order_by option expects a string with a comma-separated list of columns");
+			}
+			info->order_by.clear();
+			for (auto &column_name : StringUtil::Split(value->val.str, ',')) {
+				StringUtil::Trim(column_name);
+				if (column_name.empty()) {
+					throw ParserException(
+					    "The order_by option expects a string with a comma-separated list of columns");
+				}
+				info->order_by.push_back(column_name);
+			}
+		}
+	}
+
 	result->info = std::move(info);
 	return result;
 }
@@ -351,6 +351,25 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 		}
 		BindLogicalType(column.TypeMutable(), &result->schema.catalog);
 	}
+	// the clustering key must consist of distinct, stored columns
+	case_insensitive_set_t order_by_columns;
+	for (auto &column_name : base.order_by) {
+		if (!base.columns.ColumnExists(column_name)) {
+			throw BinderException("Table \"%s\" cannot be clustered on column \"%s\": the column does not exist",
+			                      base.table, column_name);
+		}
+		auto &column = base.columns.GetColumn(column_name);
+		if (column.Generated()) {
+			throw BinderException("Table \"%s\" cannot be clustered on generated column \"%s\"", base.table,
+			                      column_name);
+		}
+		if (!order_by_columns.insert(column_name).second) {
+			throw BinderException("Table \"%s\" is clustered on column \"%s\" more than once", base.table,
+			                      column_name);
+		}
+		// use the name as it was defined
+		column_name = column.Name();
+	}
 	result->dependencies.VerifyDependencies(schema.catalog, result->Base().table);
 
 	auto &properties = GetStatementProperties();
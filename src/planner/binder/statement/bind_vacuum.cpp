@@ -11,6 +11,9 @@ namespace duckdb {
 void Binder::BindVacuumTable(LogicalVacuum &vacuum, unique_ptr<LogicalOperator> &root) {
 	auto &info = vacuum.GetInfo();
 	if (!info.has_table) {
+		if (info.options.full) {
+			throw BinderException("VACUUM FULL requires a table");
+		}
 		return;
 	}
 
@@ -21,6 +24,9 @@ void Binder::BindVacuumTable(LogicalVacuum &vacuum, unique_ptr<LogicalOperator>
 	}
 	auto ref = unique_ptr_cast<BoundTableRef, BoundBaseTableRef>(std::move(bound_table));
 	auto &table = ref->table;
+	if (info.options.full && (!table.IsDuckTable() || table.GetOrderBy().empty())) {
+		throw BinderException("VACUUM FULL is only supported on tables that are clustered using WITH (order_by = ...)");
+	}
 	vacuum.SetTable(table);
 
 	vector<unique_ptr<Expression>> select_list;
@@ -0,0 +1,130 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+BloomFilterData::BloomFilterData(idx_t block_count_p)
+    : block_count(block_count_p), blocks(make_unsafe_uniq_array<atomic<uint64_t>>(block_count_p)) {
+	D_ASSERT(IsPowerOfTwo(block_count));
+}
+
+static idx_t GetBlockCount(idx_t key_count) {
+	auto bit_count = MaxValue<idx_t>(key_count, 1) * BloomFilter::BITS_PER_KEY;
+	return NextPowerOfTwo((bit_count + 63) / 64);
+}
+
+BloomFilter::BloomFilter(idx_t key_count)
+    : BloomFilter(make_shared_ptr<BloomFilterData>(GetBlockCount(key_count))) {
+}
+
+BloomFilter::BloomFilter(shared_ptr<BloomFilterData> data_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), data(std::move(data_p)) {
+}
+
+uint64_t BloomFilter::GetMask(hash_t hash) {
+	// the lower bits of the hash select the block, the upper bits select the bits within the block
+	uint64_t mask = 0;
+	for (idx_t i = 0; i < BITS_PER_HASH; i++) {
+		mask |= uint64_t(1) << ((hash >> (64 - 6 * (i + 1))) & 63);
+	}
+	return mask;
+}
+
+void BloomFilter::InsertHashes(const hash_t *hashes, idx_t count) {
+	auto &blocks = data->blocks;
+	const auto block_mask = data->block_count - 1;
+	for (idx_t i = 0; i < count; i++) {
+		blocks[hashes[i] & block_mask].fetch_or(GetMask(hashes[i]), std::memory_order_relaxed);
+	}
+}
+
+bool BloomFilter::LookupHash(hash_t hash) const {
+	const auto mask = GetMask(hash);
+	const auto block = data->blocks[hash & (data->block_count - 1)].load(std::memory_order_relaxed);
+	return (block & mask) == mask;
+}
+
+idx_t BloomFilter::Filter(Vector &vector, idx_t count, SelectionVector &sel, idx_t approved_tuple_count) const {
+	if (approved_tuple_count == 0) {
+		return 0;
+	}
+	UnifiedVectorFormat vdata;
+	vector.ToUnifiedFormat(count, vdata);
+
+	// only hash the rows that are still selected
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (!vdata.validity.RowIsValid(vdata.sel->get_index(idx))) {
+			// NULL values never match an equality join condition
+			continue;
+		}
+		if (LookupHash(hash_data[hdata.sel->get_index(idx)])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	return result_count;
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	// bloom filters cannot be checked against min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM_FILTER(" + to_string(data->block_count * 64) + " bits)";
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.data == data;
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	// the bit array is not modified after the filter has been pushed - copies can share it
+	return make_uniq<BloomFilter>(data);
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// a bloom filter only ever removes rows that cannot match, so it is safe to not evaluate it at all
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WriteProperty<idx_t>(200, "block_count", data->block_count);
+	serializer.WriteList(201, "blocks", data->block_count, [&](Serializer::List &list, idx_t i) {
+		list.WriteElement<uint64_t>(data->blocks[i].load(std::memory_order_relaxed));
+	});
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto block_count = deserializer.ReadProperty<idx_t>(200, "block_count");
+	auto data = make_shared_ptr<BloomFilterData>(block_count);
+	deserializer.ReadList(201, "blocks", [&](Deserializer::List &list, idx_t i) {
+		if (i >= block_count) {
+			throw SerializationException("Bloom filter contains more blocks than expected");
+		}
+		data->blocks[i].store(list.ReadElement<uint64_t>(), std::memory_order_relaxed);
+	});
+	return make_uniq<BloomFilter>(std::move(data));
+}
+
+} // namespace duckdb
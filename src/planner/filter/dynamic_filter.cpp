@@ -0,0 +1,72 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> l(lock);
+	initialized = false;
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	lock_guard<mutex> l(filter_data->lock);
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = filter_data->filter->CheckStatistics(stats);
+	if (result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+		// the filter can become more selective later on - we cannot mark it as always true
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return result;
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (filter_data) {
+		lock_guard<mutex> l(filter_data->lock);
+		if (filter_data->initialized) {
+			return "Dynamic Filter (" + filter_data->filter->ToString(column_name) + ")";
+		}
+	}
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data == filter_data;
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// copies share the filter state, so that they observe updates to the filter
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// a dynamic filter only ever removes rows that cannot be part of the result, so it is safe to not evaluate it
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+void DynamicFilter::Serialize(Serializer &serializer) const {
+	// the filter state only exists while the query is running - it is not serialized
+	TableFilter::Serialize(serializer);
+}
+
+unique_ptr<TableFilter> DynamicFilter::Deserialize(Deserializer &deserializer) {
+	return make_uniq<DynamicFilter>();
+}
+
+} // namespace duckdb
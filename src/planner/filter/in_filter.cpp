@@ -0,0 +1,79 @@
+#include "duckdb/planner/filter/in_filter.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+static Vector CreateSortedValues(const vector<Value> &values) {
+	if (values.empty()) {
+		return Vector(Value());
+	}
+	auto sorted = values;
+	std::sort(sorted.begin(), sorted.end());
+	Vector result(sorted[0].type(), sorted.size());
+	for (idx_t i = 0; i < sorted.size(); i++) {
+		result.SetValue(i, sorted[i]);
+	}
+	return result;
+}
+
+InFilter::InFilter(vector<Value> values_p)
+    : TableFilter(TableFilterType::IN_FILTER), values(std::move(values_p)), sorted_values(CreateSortedValues(values)) {
+	for (auto &val : values) {
+		if (val.IsNull()) {
+			throw InternalException("InFilter constant cannot be NULL - use IsNullFilter instead");
+		}
+	}
+}
+
+FilterPropagateResult InFilter::CheckStatistics(BaseStatistics &stats) {
+	// the IN filter is true if ANY of the values is equal: check the zonemap for each of the values
+	D_ASSERT(!values.empty());
+	for (auto &value : values) {
+		ConstantFilter equality_filter(ExpressionType::COMPARE_EQUAL, value);
+		auto prune_result = equality_filter.CheckStatistics(stats);
+		if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		} else if (prune_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
+			return FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		}
+	}
+	return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+}
+
+string InFilter::ToString(const string &column_name) {
+	string in_list;
+	for (auto &val : values) {
+		if (!in_list.empty()) {
+			in_list += ", ";
+		}
+		in_list += val.ToSQLString();
+	}
+	return column_name + " IN (" + in_list + ")";
+}
+
+bool InFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<InFilter>();
+	return other.values == values;
+}
+
+unique_ptr<TableFilter> InFilter::Copy() const {
+	return make_uniq<InFilter>(values);
+}
+
+unique_ptr<Expression> InFilter::ToExpression(const Expression &column) const {
+	auto result = make_uniq<BoundOperatorExpression>(ExpressionType::COMPARE_IN, LogicalType::BOOLEAN);
+	result->children.push_back(column.Copy());
+	for (auto &val : values) {
+		result->children.push_back(make_uniq<BoundConstantExpression>(val));
+	}
+	return std::move(result);
+}
+
+} // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
@@ -25,6 +26,14 @@ CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+vector<column_t> TableDataWriter::GetOrderByColumns() {
+	vector<column_t> result;
+	for (auto &column_name : table.GetOrderBy()) {
+		result.push_back(table.GetColumn(column_name).Physical().index);
+	}
+	return result;
+}
+
 void TableDataWriter::AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer) {
 	row_group_pointers.push_back(std::move(row_group_pointer));
 }
@@ -60,6 +69,10 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 	stats_serializer.End();
 
 	// now start writing the row group pointers to disk
+	// newer storage versions store the metadata blocks of every row group as well
+	SerializationOptions serialization_options;
+	auto &config = DBConfig::GetConfig(table.ParentCatalog().GetDatabase());
+	serialization_options.serialization_compatibility = config.options.serialization_compatibility;
 	table_data_writer.Write<uint64_t>(row_group_pointers.size());
 	idx_t total_rows = 0;
 	for (auto &row_group_pointer : row_group_pointers) {
@@ -69,7 +82,7 @@ void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stat
 		}
 
 		// Each RowGroup is its own unit
-		BinarySerializer row_group_serializer(table_data_writer);
+		BinarySerializer row_group_serializer(table_data_writer, serialization_options);
 		row_group_serializer.Begin();
 		RowGroup::Serialize(row_group_pointer, row_group_serializer);
 		row_group_serializer.End();
@@ -107,6 +107,8 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         SelectionVector &sel, idx_t &approved_tuple_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -444,6 +446,11 @@ struct CompressedStringScanState : public StringScanState {
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The number of entries in the dictionary
+	idx_t dictionary_size = 0;
+	//! The filter that was last evaluated on the dictionary, and for every entry whether it passed that filter
+	optional_ptr<const TableFilter> dictionary_filter;
+	unsafe_unique_array<bool> dictionary_matches;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -463,6 +470,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -554,6 +562,69 @@ void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScan
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                                Vector &result, SelectionVector &sel, idx_t &approved_tuple_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	// evaluate the filter once for every entry of the dictionary, instead of once for every row
+	if (scan_state.dictionary_filter.get() != &filter) {
+		auto &dictionary = *scan_state.dictionary;
+		auto dictionary_size = scan_state.dictionary_size;
+		if (!scan_state.dictionary_matches) {
+			scan_state.dictionary_matches = make_unsafe_uniq_array<bool>(dictionary_size);
+		}
+		memset(scan_state.dictionary_matches.get(), 0, dictionary_size * sizeof(bool));
+
+		UnifiedVectorFormat vdata;
+		dictionary.ToUnifiedFormat(dictionary_size, vdata);
+		SelectionVector dictionary_sel;
+		idx_t match_count = dictionary_size;
+		ColumnSegment::FilterSelection(dictionary_sel, dictionary, vdata, filter, dictionary_size, match_count);
+		for (idx_t i = 0; i < match_count; i++) {
+			scan_state.dictionary_matches[dictionary_sel.get_index(i)] = true;
+		}
+		scan_state.dictionary_filter = &filter;
+	}
+
+	// unpack the dictionary indexes of the rows
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
+
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	sel_t *sel_vec_ptr = scan_state.sel_vec->data();
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(sel_vec_ptr), src, decompress_count,
+	                                          scan_state.current_width);
+
+	// only the rows that pass the filter are materialized
+	auto dictionary_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto string_number = sel_vec_ptr[idx + start_offset];
+		if (!validity.RowIsValid(idx) || !scan_state.dictionary_matches[string_number]) {
+			continue;
+		}
+		result_data[idx] = dictionary_data[string_number];
+		new_sel.set_index(result_count++, idx);
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -651,13 +722,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const PhysicalType physical_type) {
@@ -52,6 +52,8 @@ struct FSSTStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         const SelectionVector &sel, idx_t sel_count);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -647,6 +649,49 @@ void FSSTStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx
 	StringScanPartial<true>(segment, state, scan_count, result, 0);
 }
 
+void FSSTStorage::StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                               const SelectionVector &sel, idx_t sel_count) {
+	auto &scan_state = state.scan_state->Cast<FSSTScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto dict = GetDictionary(segment, scan_state.handle);
+	auto base_data = data_ptr_cast(baseptr + sizeof(fsst_compression_header_t));
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	if (start == 0 || scan_state.last_known_row >= (int64_t)start) {
+		scan_state.ResetStoredDelta();
+	}
+
+	// the string offsets are delta encoded, so we need to decode them for the entire vector
+	auto offsets = CalculateBpDeltaOffsets(scan_state.last_known_row, start, scan_count);
+
+	auto bitunpack_buffer = unsafe_unique_ptr<uint32_t[]>(new uint32_t[offsets.total_bitunpack_count]);
+	BitUnpackRange(base_data, data_ptr_cast(bitunpack_buffer.get()), offsets.total_bitunpack_count,
+	               offsets.bitunpack_start_row, scan_state.current_width);
+	auto delta_decode_buffer = unsafe_unique_ptr<uint32_t[]>(new uint32_t[offsets.total_delta_decode_count]);
+	DeltaDecodeIndices(bitunpack_buffer.get() + offsets.bitunpack_alignment_offset, delta_decode_buffer.get(),
+	                   offsets.total_delta_decode_count, scan_state.last_known_index);
+
+	// but only the selected strings have to be decompressed
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		uint32_t str_len = bitunpack_buffer[idx + offsets.scan_offset];
+		if (str_len > 0) {
+			auto str_ptr = FSSTStorage::FetchStringPointer(
+			    dict, baseptr,
+			    UnsafeNumericCast<int32_t>(delta_decode_buffer[idx + offsets.unused_delta_decoded_values]));
+			result_data[i] = FSSTPrimitives::DecompressValue(scan_state.duckdb_fsst_decoder.get(), result, str_ptr,
+			                                                 str_len, scan_state.decompress_buffer);
+		} else {
+			result_data[i] = string_t(nullptr, 0);
+		}
+	}
+
+	scan_state.StoreLastDelta(delta_decode_buffer[scan_count + offsets.unused_delta_decoded_values - 1],
+	                          UnsafeNumericCast<int64_t>(start + scan_count - 1));
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -699,11 +744,13 @@ void FSSTStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state
 //===--------------------------------------------------------------------===//
 CompressionFunction FSSTFun::GetFunction(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::VARCHAR);
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_FSST, data_type, FSSTStorage::StringInitAnalyze, FSSTStorage::StringAnalyze,
 	    FSSTStorage::StringFinalAnalyze, FSSTStorage::InitCompression, FSSTStorage::Compress,
 	    FSSTStorage::FinalizeCompress, FSSTStorage::StringInitScan, FSSTStorage::StringScan,
 	    FSSTStorage::StringScanPartial<false>, FSSTStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.select = FSSTStorage::StringSelect;
+	return function;
 }
 
 bool FSSTFun::TypeIsSupported(const PhysicalType physical_type) {
@@ -43,6 +43,11 @@ void ConstantScanPartialValidity(ColumnSegment &segment, ColumnScanState &state,
 	ConstantFillFunctionValidity(segment, result, result_offset, scan_count);
 }
 
+void ConstantSelectFunctionValidity(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                    const SelectionVector &sel, idx_t sel_count) {
+	ConstantFillFunctionValidity(segment, result, 0, sel_count);
+}
+
 template <class T>
 void ConstantScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
                          idx_t result_offset) {
@@ -92,9 +97,12 @@ void ConstantFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row
 //===--------------------------------------------------------------------===//
 CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::BIT);
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunctionValidity,
-	                           ConstantScanPartialValidity, ConstantFetchRowValidity, UncompressedFunctions::EmptySkip);
+	auto function =
+	    CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	                        nullptr, nullptr, ConstantInitScan, ConstantScanFunctionValidity,
+	                        ConstantScanPartialValidity, ConstantFetchRowValidity, UncompressedFunctions::EmptySkip);
+	function.select = ConstantSelectFunctionValidity;
+	return function;
 }
 
 template <class T>
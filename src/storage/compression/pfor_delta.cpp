@@ -0,0 +1,549 @@
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+// PFOR-delta (patched frame-of-reference over deltas) compresses groups of PFOR_DELTA_GROUP_SIZE values. Each group
+// stores its first value, and the deltas between consecutive values minus the smallest delta (the frame of
+// reference), bitpacked at a width that covers most of them. The deltas that do not fit the width are stored as
+// exceptions behind the packed data, and patched in after unpacking. A single outlier therefore only costs one
+// exception, instead of widening the whole group.
+//
+// Groups are independent of each other, so skipping and fetching rows only decodes the group that contains them.
+// NULL values repeat the previous value, so they do not break up runs of small deltas.
+//
+// Segment layout: the data of the groups grows upwards after a header that holds the offset of the metadata, the
+// metadata (a uint32_t offset of every group) is written downwards from the end of the block, and moved next to the
+// data when the segment is flushed.
+//
+// Group layout:
+// [T first value][T frame of reference][uint16_t exception count][uint8_t width][uint8_t padding]
+// [packed deltas][uint16_t exception positions, padded to 4 bytes][T exception values]
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = 1024;
+
+template <class T>
+struct PForDeltaGroup {
+	static constexpr const idx_t HEADER_SIZE = 2 * sizeof(T) + sizeof(uint32_t);
+
+	static idx_t GetExceptionSize(idx_t exception_count) {
+		return AlignValue<idx_t, sizeof(uint32_t)>(exception_count * sizeof(uint16_t)) + exception_count * sizeof(T);
+	}
+};
+
+template <class T>
+struct PForDeltaEncoder {
+	using T_U = typename MakeUnsigned<T>::type;
+	using T_S = typename MakeSigned<T>::type;
+	static constexpr const bitpacking_width_t TYPE_WIDTH = sizeof(T) * 8;
+
+public:
+	PForDeltaEncoder() {
+		Reset();
+	}
+
+	T_U values[PFOR_DELTA_GROUP_SIZE];
+	bool validity[PFOR_DELTA_GROUP_SIZE];
+	idx_t count;
+
+	// Stats on the current group
+	T minimum;
+	T maximum;
+	bool all_invalid;
+
+	// The encoded group, set by Encode
+	T_U residuals[PFOR_DELTA_GROUP_SIZE];
+	uint16_t exception_positions[PFOR_DELTA_GROUP_SIZE];
+	T_U exception_values[PFOR_DELTA_GROUP_SIZE];
+	idx_t exception_count;
+	T_U frame_of_reference;
+	bitpacking_width_t width;
+
+public:
+	void Reset() {
+		count = 0;
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+		all_invalid = true;
+	}
+
+	//! Adds a value to the group, returns true if the group is full
+	bool Append(T value, bool is_valid) {
+		D_ASSERT(count < PFOR_DELTA_GROUP_SIZE);
+		validity[count] = is_valid;
+		if (is_valid) {
+			values[count] = static_cast<T_U>(value);
+			minimum = MinValue<T>(minimum, value);
+			maximum = MaxValue<T>(maximum, value);
+			all_invalid = false;
+		}
+		count++;
+		return count == PFOR_DELTA_GROUP_SIZE;
+	}
+
+	//! Encodes the values of the group, and returns the encoded size
+	idx_t Encode() {
+		D_ASSERT(count > 0);
+		FillNulls();
+
+		// all arithmetic is done on unsigned values, so that it wraps around instead of overflowing
+		T_S min_delta = count > 1 ? NumericLimits<T_S>::Maximum() : 0;
+		for (idx_t i = 1; i < count; i++) {
+			auto delta = static_cast<T_S>(static_cast<T_U>(values[i] - values[i - 1]));
+			min_delta = MinValue<T_S>(min_delta, delta);
+		}
+		frame_of_reference = static_cast<T_U>(min_delta);
+
+		// count how many residuals require each width
+		idx_t width_counts[TYPE_WIDTH + 1] = {0};
+		residuals[0] = 0;
+		width_counts[0]++;
+		for (idx_t i = 1; i < count; i++) {
+			residuals[i] = static_cast<T_U>(values[i] - values[i - 1] - frame_of_reference);
+			width_counts[TYPE_WIDTH - CountZeros<T_U>::Leading(residuals[i])]++;
+		}
+
+		// pick the width for which the packed values plus the exceptions are smallest
+		idx_t best_size = NumericLimits<idx_t>::Maximum();
+		idx_t exceptions = 0;
+		for (idx_t w = TYPE_WIDTH + 1; w > 0; w--) {
+			auto candidate = UnsafeNumericCast<bitpacking_width_t>(w - 1);
+			auto size = BitpackingPrimitives::GetRequiredSize(count, candidate) +
+			            PForDeltaGroup<T>::GetExceptionSize(exceptions);
+			if (size < best_size) {
+				best_size = size;
+				width = candidate;
+				exception_count = exceptions;
+			}
+			// the residuals of exactly this width become exceptions for all smaller widths
+			exceptions += width_counts[candidate];
+		}
+
+		// move the residuals that do not fit the width into the exceptions
+		if (exception_count > 0) {
+			auto mask = (T_U(1) << width) - 1;
+			idx_t exception_idx = 0;
+			for (idx_t i = 1; i < count; i++) {
+				if (residuals[i] > mask) {
+					exception_positions[exception_idx] = UnsafeNumericCast<uint16_t>(i);
+					exception_values[exception_idx] = residuals[i];
+					residuals[i] &= mask;
+					exception_idx++;
+				}
+			}
+			D_ASSERT(exception_idx == exception_count);
+		}
+		return PForDeltaGroup<T>::HEADER_SIZE + best_size;
+	}
+
+	//! Writes the encoded group
+	void Write(data_ptr_t dst) {
+		Store<T_U>(values[0], dst);
+		Store<T_U>(frame_of_reference, dst + sizeof(T));
+		Store<uint16_t>(UnsafeNumericCast<uint16_t>(exception_count), dst + 2 * sizeof(T));
+		Store<bitpacking_width_t>(width, dst + 2 * sizeof(T) + sizeof(uint16_t));
+		Store<uint8_t>(0, dst + 2 * sizeof(T) + sizeof(uint16_t) + sizeof(bitpacking_width_t));
+		dst += PForDeltaGroup<T>::HEADER_SIZE;
+
+		BitpackingPrimitives::PackBuffer<T_U, false>(dst, residuals, count, width);
+		dst += BitpackingPrimitives::GetRequiredSize(count, width);
+
+		if (exception_count > 0) {
+			auto positions_size = exception_count * sizeof(uint16_t);
+			memcpy(dst, exception_positions, positions_size);
+			memset(dst + positions_size, 0, AlignValue<idx_t, sizeof(uint32_t)>(positions_size) - positions_size);
+			dst += AlignValue<idx_t, sizeof(uint32_t)>(positions_size);
+			memcpy(dst, exception_values, exception_count * sizeof(T));
+		}
+	}
+
+private:
+	//! Replaces the NULL values with the preceding value (or the first valid value, at the start of the group)
+	void FillNulls() {
+		if (all_invalid) {
+			memset(values, 0, count * sizeof(T_U));
+			return;
+		}
+		idx_t first_valid = 0;
+		while (!validity[first_valid]) {
+			first_valid++;
+		}
+		for (idx_t i = 0; i < first_valid; i++) {
+			values[i] = values[first_valid];
+		}
+		for (idx_t i = first_valid + 1; i < count; i++) {
+			if (!validity[i]) {
+				values[i] = values[i - 1];
+			}
+		}
+	}
+};
+
+//! Decodes a group of count values into the result, which must have room for count values rounded up to the
+//! bitpacking algorithm group size
+template <class T>
+static void PForDeltaDecodeGroup(data_ptr_t group_ptr, idx_t count, T *result) {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	auto first_value = Load<T_U>(group_ptr);
+	auto frame_of_reference = Load<T_U>(group_ptr + sizeof(T));
+	auto exception_count = Load<uint16_t>(group_ptr + 2 * sizeof(T));
+	auto width = Load<bitpacking_width_t>(group_ptr + 2 * sizeof(T) + sizeof(uint16_t));
+	auto packed_ptr = group_ptr + PForDeltaGroup<T>::HEADER_SIZE;
+
+	// the unpacking and the frame of reference are branch-free loops over fixed-size blocks, the exceptions are
+	// patched in separately
+	auto values = reinterpret_cast<T_U *>(result);
+	BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(values), packed_ptr, count, width);
+
+	auto positions_ptr = packed_ptr + BitpackingPrimitives::GetRequiredSize(count, width);
+	auto exception_values_ptr =
+	    positions_ptr + AlignValue<idx_t, sizeof(uint32_t)>(exception_count * sizeof(uint16_t));
+	for (idx_t i = 0; i < exception_count; i++) {
+		auto position = Load<uint16_t>(positions_ptr + i * sizeof(uint16_t));
+		values[position] = Load<T_U>(exception_values_ptr + i * sizeof(T));
+	}
+
+	for (idx_t i = 0; i < count; i++) {
+		values[i] += frame_of_reference;
+	}
+	values[0] = first_value;
+	for (idx_t i = 1; i < count; i++) {
+		values[i] += values[i - 1];
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	explicit PForDeltaAnalyzeState(const CompressionInfo &info) : AnalyzeState(info), total_size(0) {
+	}
+
+	PForDeltaEncoder<T> encoder;
+	idx_t total_size;
+
+	void FlushGroup() {
+		if (encoder.count == 0) {
+			return;
+		}
+		total_size += encoder.Encode() + sizeof(uint32_t);
+		encoder.Reset();
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<PForDeltaAnalyzeState<T>>(info);
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaAnalyzeState<T>>();
+
+	// a group that cannot be compressed at all must still fit into a block; we are conservative here
+	if (sizeof(T) * PFOR_DELTA_GROUP_SIZE * 2 > state.info.GetBlockSize()) {
+		return false;
+	}
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (state.encoder.Append(data[idx], vdata.validity.RowIsValid(idx))) {
+			state.FlushGroup();
+		}
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<PForDeltaAnalyzeState<T>>();
+	state.FlushGroup();
+	return state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaCompressState : public CompressionState {
+public:
+	PForDeltaCompressState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	// Ptr to next free spot in segment;
+	data_ptr_t data_ptr;
+	// Ptr to next free spot for storing the group offsets (growing downwards).
+	data_ptr_t metadata_ptr;
+
+	PForDeltaEncoder<T> encoder;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		compressed_segment->function = function;
+		current_segment = std::move(compressed_segment);
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + BitpackingPrimitives::BITPACKING_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+	}
+
+	bool CanStore(idx_t group_size) {
+		auto required_data_bytes = NumericCast<idx_t>(data_ptr - handle.Ptr()) + group_size;
+		auto required_meta_bytes = NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) +
+		                           sizeof(uint32_t);
+		return required_data_bytes + required_meta_bytes <= info.GetBlockSize();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			if (encoder.Append(data[idx], vdata.validity.RowIsValid(idx))) {
+				FlushGroup();
+			}
+		}
+	}
+
+	void FlushGroup() {
+		if (encoder.count == 0) {
+			return;
+		}
+		auto group_size = encoder.Encode();
+		if (!CanStore(group_size)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+			if (!CanStore(group_size)) {
+				throw InternalException("PFOR compression failed due to insufficient space in empty block");
+			}
+		}
+
+		metadata_ptr -= sizeof(uint32_t);
+		Store<uint32_t>(NumericCast<uint32_t>(data_ptr - handle.Ptr()), metadata_ptr);
+		encoder.Write(data_ptr);
+		data_ptr += group_size;
+
+		current_segment->count += encoder.count;
+		if (!encoder.all_invalid) {
+			NumericStats::Update<T>(current_segment->stats.statistics, encoder.minimum);
+			NumericStats::Update<T>(current_segment->stats.statistics, encoder.maximum);
+		}
+		encoder.Reset();
+	}
+
+	void FlushSegment() {
+		auto &state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// Compact the segment by moving the metadata next to the data.
+		// The group sizes are multiples of four bytes, so the metadata is always aligned.
+		auto metadata_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		auto metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		auto total_segment_size = metadata_offset + metadata_size;
+		D_ASSERT(metadata_offset % sizeof(uint32_t) == 0);
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+
+		// Store the offset of the end of the metadata (the metadata of the first group is at the highest address).
+		Store<idx_t>(total_segment_size, base_ptr);
+		handle.Destroy();
+
+		state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		FlushGroup();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T>>(checkpointer, state->info);
+}
+
+template <class T>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaScanState : public SegmentScanState {
+public:
+	explicit PForDeltaScanState(ColumnSegment &segment)
+	    : current_segment(segment), decoded_group(DConstants::INVALID_INDEX) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		metadata_end = base_ptr + Load<idx_t>(base_ptr);
+	}
+
+	BufferHandle handle;
+	ColumnSegment &current_segment;
+	data_ptr_t base_ptr;
+	data_ptr_t metadata_end;
+
+	//! The group that was last decoded into the decompression buffer
+	idx_t decoded_group;
+	T decompression_buffer[PFOR_DELTA_GROUP_SIZE];
+
+public:
+	data_ptr_t GetGroupPtr(idx_t group_idx) {
+		auto offset = Load<uint32_t>(metadata_end - (group_idx + 1) * sizeof(uint32_t));
+		return base_ptr + offset;
+	}
+
+	idx_t GetGroupCount(idx_t group_idx) {
+		return MinValue<idx_t>(PFOR_DELTA_GROUP_SIZE, current_segment.count - group_idx * PFOR_DELTA_GROUP_SIZE);
+	}
+
+	void DecodeGroup(idx_t group_idx) {
+		if (decoded_group == group_idx) {
+			return;
+		}
+		PForDeltaDecodeGroup<T>(GetGroupPtr(group_idx), GetGroupCount(group_idx), decompression_buffer);
+		decoded_group = group_idx;
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	auto result = make_uniq<PForDeltaScanState<T>>(segment);
+	return std::move(result);
+}
+
+//===--------------------------------------------------------------------===//
+// Scan base data
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	T *result_data = FlatVector::GetData<T>(result);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		auto group_idx = row / PFOR_DELTA_GROUP_SIZE;
+		auto offset_in_group = row % PFOR_DELTA_GROUP_SIZE;
+		auto group_count = scan_state.GetGroupCount(group_idx);
+		auto to_scan = MinValue<idx_t>(scan_count - scanned, group_count - offset_in_group);
+
+		T *current_result_ptr = result_data + result_offset + scanned;
+		if (to_scan == PFOR_DELTA_GROUP_SIZE) {
+			// Decode the full group directly into the result vector
+			PForDeltaDecodeGroup<T>(scan_state.GetGroupPtr(group_idx), to_scan, current_result_ptr);
+		} else {
+			scan_state.DecodeGroup(group_idx);
+			memcpy(current_result_ptr, scan_state.decompression_buffer + offset_in_group, to_scan * sizeof(T));
+		}
+		scanned += to_scan;
+	}
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	PForDeltaScanState<T> scan_state(segment);
+	auto row = NumericCast<idx_t>(row_id);
+	scan_state.DecodeGroup(row / PFOR_DELTA_GROUP_SIZE);
+
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	T *result_data = FlatVector::GetData<T>(result);
+	result_data[result_idx] = scan_state.decompression_buffer[row % PFOR_DELTA_GROUP_SIZE];
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	// the groups are independent and the scan locates them through the row index, so skipping is free
+	return CompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                           PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>, PForDeltaInitCompression<T>,
+	                           PForDeltaCompress<T>, PForDeltaFinalizeCompress<T>, PForDeltaInitScan<T>,
+	                           PForDeltaScan<T>, PForDeltaScanPartial<T>, PForDeltaFetchRow<T>,
+	                           UncompressedFunctions::EmptySkip);
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(const PhysicalType physical_type) {
+	switch (physical_type) {
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
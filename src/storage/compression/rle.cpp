@@ -276,6 +276,11 @@ struct RLEScanState : public SegmentScanState {
 	idx_t entry_pos;
 	idx_t position_in_entry;
 	uint32_t rle_count_offset;
+	//! The values of the runs that overlap with the vector that is being filtered
+	unique_ptr<Vector> run_values;
+	//! For every run: the (exclusive) end position within the vector, and whether the value passed the filter
+	unsafe_unique_array<sel_t> run_ends;
+	unsafe_unique_array<bool> run_matches;
 };
 
 template <class T>
@@ -374,6 +379,85 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+               idx_t &approved_tuple_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	if (!scan_state.run_values) {
+		scan_state.run_values = make_uniq<Vector>(segment.type);
+		scan_state.run_ends = make_unsafe_uniq_array<sel_t>(STANDARD_VECTOR_SIZE);
+		scan_state.run_matches = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+	}
+	auto &run_values = *scan_state.run_values;
+	auto run_data = FlatVector::GetData<T>(run_values);
+	auto run_ends = scan_state.run_ends.get();
+	auto run_matches = scan_state.run_matches.get();
+
+	// gather the runs that overlap with this vector, and move the scan state past the vector
+	idx_t run_count = 0;
+	idx_t position = 0;
+	while (position < scan_count) {
+		idx_t remaining_in_run = index_pointer[scan_state.entry_pos] - scan_state.position_in_entry;
+		idx_t step = MinValue<idx_t>(remaining_in_run, scan_count - position);
+		run_data[run_count] = data_pointer[scan_state.entry_pos];
+		position += step;
+		run_ends[run_count] = UnsafeNumericCast<sel_t>(position);
+		run_matches[run_count] = false;
+		run_count++;
+
+		scan_state.position_in_entry += step;
+		if (ExhaustedRun(scan_state, index_pointer)) {
+			ForwardToNextRun(scan_state);
+		}
+	}
+
+	// evaluate the filter once for every run, instead of once for every row
+	UnifiedVectorFormat vdata;
+	run_values.ToUnifiedFormat(run_count, vdata);
+	SelectionVector run_sel;
+	idx_t match_count = run_count;
+	ColumnSegment::FilterSelection(run_sel, run_values, vdata, filter, run_count, match_count);
+	if (match_count == 0) {
+		approved_tuple_count = 0;
+		return;
+	}
+	for (idx_t i = 0; i < match_count; i++) {
+		run_matches[run_sel.get_index(i)] = true;
+	}
+
+	// only the rows that pass the filter are materialized
+	auto result_data = FlatVector::GetData<T>(result);
+	auto &validity = FlatVector::Validity(result);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	idx_t run_idx = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (run_idx > 0 && idx < run_ends[run_idx - 1]) {
+			// the selection is not ordered: search from the start again
+			run_idx = 0;
+		}
+		while (idx >= run_ends[run_idx]) {
+			run_idx++;
+		}
+		if (!validity.RowIsValid(idx) || !run_matches[run_idx]) {
+			continue;
+		}
+		result_data[idx] = run_data[run_idx];
+		new_sel.set_index(result_count++, idx);
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -393,10 +477,15 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	auto function = CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                                    RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                                    RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                                    RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	if (WRITE_STATISTICS) {
+		// segments without statistics store list offsets, which are never filtered
+		function.filter = RLEFilter<T>;
+	}
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
@@ -114,6 +114,27 @@ void UncompressedStringStorage::StringScan(ColumnSegment &segment, ColumnScanSta
 	StringScanPartial(segment, state, scan_count, result, 0);
 }
 
+void UncompressedStringStorage::StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                             Vector &result, const SelectionVector &sel, idx_t sel_count) {
+	// only fetch the selected strings - this avoids reading big strings of rows that are filtered out
+	auto &scan_state = state.scan_state->Cast<StringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	auto baseptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto dict = GetDictionary(segment, scan_state.handle);
+	auto base_data = reinterpret_cast<int32_t *>(baseptr + DICTIONARY_HEADER_SIZE);
+	auto result_data = FlatVector::GetData<string_t>(result);
+
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row = start + sel.get_index(i);
+		auto dict_offset = base_data[row];
+		int32_t previous_offset = row > 0 ? base_data[row - 1] : 0;
+		// std::abs used since offsets can be negative to indicate big strings
+		auto string_length = UnsafeNumericCast<uint32_t>(std::abs(dict_offset) - std::abs(previous_offset));
+		result_data[i] = FetchStringFromDict(segment, dict, result, baseptr, dict_offset, string_length);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -248,17 +269,20 @@ void UncompressedStringStorage::CleanupState(ColumnSegment &segment) {
 //===--------------------------------------------------------------------===//
 CompressionFunction StringUncompressed::GetFunction(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::VARCHAR);
-	return CompressionFunction(CompressionType::COMPRESSION_UNCOMPRESSED, data_type,
-	                           UncompressedStringStorage::StringInitAnalyze, UncompressedStringStorage::StringAnalyze,
-	                           UncompressedStringStorage::StringFinalAnalyze, UncompressedFunctions::InitCompression,
-	                           UncompressedFunctions::Compress, UncompressedFunctions::FinalizeCompress,
-	                           UncompressedStringStorage::StringInitScan, UncompressedStringStorage::StringScan,
-	                           UncompressedStringStorage::StringScanPartial, UncompressedStringStorage::StringFetchRow,
-	                           UncompressedFunctions::EmptySkip, UncompressedStringStorage::StringInitSegment,
-	                           UncompressedStringStorage::StringInitAppend, UncompressedStringStorage::StringAppend,
-	                           UncompressedStringStorage::FinalizeAppend, nullptr,
-	                           UncompressedStringStorage::SerializeState, UncompressedStringStorage::DeserializeState,
-	                           UncompressedStringStorage::CleanupState, UncompressedStringInitPrefetch);
+	auto function =
+	    CompressionFunction(CompressionType::COMPRESSION_UNCOMPRESSED, data_type,
+	                        UncompressedStringStorage::StringInitAnalyze, UncompressedStringStorage::StringAnalyze,
+	                        UncompressedStringStorage::StringFinalAnalyze, UncompressedFunctions::InitCompression,
+	                        UncompressedFunctions::Compress, UncompressedFunctions::FinalizeCompress,
+	                        UncompressedStringStorage::StringInitScan, UncompressedStringStorage::StringScan,
+	                        UncompressedStringStorage::StringScanPartial, UncompressedStringStorage::StringFetchRow,
+	                        UncompressedFunctions::EmptySkip, UncompressedStringStorage::StringInitSegment,
+	                        UncompressedStringStorage::StringInitAppend, UncompressedStringStorage::StringAppend,
+	                        UncompressedStringStorage::FinalizeAppend, nullptr,
+	                        UncompressedStringStorage::SerializeState, UncompressedStringStorage::DeserializeState,
+	                        UncompressedStringStorage::CleanupState, UncompressedStringInitPrefetch);
+	function.select = UncompressedStringStorage::StringSelect;
+	return function;
 }
 
 //===--------------------------------------------------------------------===//
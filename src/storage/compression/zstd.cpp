@@ -0,0 +1,486 @@
+#include "duckdb/common/constants.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// A ZSTD segment consists of a header, followed by a sequence of independently compressed frames and a directory
+// with one entry per frame. A frame holds a run of consecutive rows: the lengths of the strings, followed by the
+// concatenated string data. Frames are small enough that a (partial) vector can be decompressed on its own.
+typedef struct {
+	uint32_t frame_count;
+	uint32_t directory_offset;
+} zstd_compression_header_t;
+
+typedef struct {
+	//! The index of the first row of the frame within the segment
+	uint32_t row_start;
+	//! The offset of the compressed frame within the segment
+	uint32_t frame_offset;
+	uint32_t compressed_size;
+	uint32_t uncompressed_size;
+} zstd_frame_entry_t;
+
+struct ZSTDStorage {
+	//! The compression level used for the frames
+	static constexpr int COMPRESSION_LEVEL = 3;
+
+	//! The maximum (uncompressed) size of a frame
+	static idx_t GetFrameSizeLimit(idx_t block_size) {
+		return block_size / 4;
+	}
+
+	static unique_ptr<AnalyzeState> StringInitAnalyze(ColumnData &col_data, PhysicalType type);
+	static bool StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count);
+	static idx_t StringFinalAnalyze(AnalyzeState &state_p);
+
+	static unique_ptr<CompressionState> InitCompression(ColumnDataCheckpointer &checkpointer,
+	                                                    unique_ptr<AnalyzeState> analyze_state_p);
+	static void Compress(CompressionState &state_p, Vector &scan_vector, idx_t count);
+	static void FinalizeCompress(CompressionState &state_p);
+
+	static unique_ptr<SegmentScanState> StringInitScan(ColumnSegment &segment);
+	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                              idx_t result_offset);
+	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	static void StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+	                         const SelectionVector &sel, idx_t sel_count);
+	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+	                           idx_t result_idx);
+
+	//! Returns the index of the frame that contains the given row of the segment
+	static idx_t FindFrame(const zstd_frame_entry_t *directory, idx_t frame_count, idx_t row);
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info) : AnalyzeState(info), count(0), total_string_size(0) {
+	}
+
+	idx_t count;
+	idx_t total_string_size;
+};
+
+unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(col_data.GetBlockManager().GetBlockSize());
+	return make_uniq<ZSTDAnalyzeState>(info);
+}
+
+bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+
+	auto frame_size_limit = GetFrameSizeLimit(state.info.GetBlockSize());
+	state.count += count;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		// every string must fit into a frame on its own
+		auto string_size = data[idx].GetSize();
+		if (string_size + sizeof(uint32_t) > frame_size_limit) {
+			return false;
+		}
+		state.total_string_size += string_size;
+	}
+	return true;
+}
+
+idx_t ZSTDStorage::StringFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	if (state.count == 0) {
+		return DConstants::INVALID_INDEX;
+	}
+	// ZSTD is only used when it is explicitly requested, so we do not spend time on estimating the compressed size
+	return state.total_string_size + state.count * sizeof(uint32_t);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+class ZSTDCompressionState : public CompressionState {
+public:
+	ZSTDCompressionState(ColumnDataCheckpointer &checkpointer, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame_size_limit(ZSTDStorage::GetFrameSizeLimit(info.GetBlockSize())), pending_size(0) {
+		compression_context = duckdb_zstd::ZSTD_createCCtx();
+		if (!compression_context) {
+			throw InternalException("ZSTD compression failed to allocate a compression context");
+		}
+		compress_buffer.resize(duckdb_zstd::ZSTD_compressBound(frame_size_limit));
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	~ZSTDCompressionState() override {
+		duckdb_zstd::ZSTD_freeCCtx(compression_context);
+	}
+
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		auto compressed_segment =
+		    ColumnSegment::CreateTransientSegment(db, type, row_start, info.GetBlockSize(), info.GetBlockSize());
+		current_segment = std::move(compressed_segment);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		current_handle = buffer_manager.Pin(current_segment->block);
+		directory.clear();
+		segment_data_end = sizeof(zstd_compression_header_t);
+	}
+
+	void AddString(const string_t &str, bool is_valid) {
+		auto string_size = is_valid ? str.GetSize() : 0;
+		auto required_size = sizeof(uint32_t) + string_size;
+		if (!pending_lengths.empty() && PendingFrameSize() + required_size > frame_size_limit) {
+			FlushFrame();
+		}
+		pending_lengths.push_back(UnsafeNumericCast<uint32_t>(string_size));
+		pending_validity.push_back(is_valid);
+		if (string_size > 0) {
+			pending_data.append(str.GetData(), string_size);
+		}
+		pending_size += string_size;
+		if (pending_lengths.size() == STANDARD_VECTOR_SIZE) {
+			FlushFrame();
+		}
+	}
+
+	idx_t PendingFrameSize() const {
+		return pending_lengths.size() * sizeof(uint32_t) + pending_size;
+	}
+
+	// Returns the size of the segment, if a frame of the given compressed size were to be added to it
+	idx_t RequiredSegmentSize(idx_t compressed_size) const {
+		auto directory_offset = AlignValue<idx_t, sizeof(uint32_t)>(segment_data_end + compressed_size);
+		return directory_offset + (directory.size() + 1) * sizeof(zstd_frame_entry_t);
+	}
+
+	void FlushFrame() {
+		if (pending_lengths.empty()) {
+			return;
+		}
+		// assemble the uncompressed frame: the string lengths followed by the string data
+		auto row_count = pending_lengths.size();
+		frame_buffer.resize(PendingFrameSize());
+		memcpy(frame_buffer.data(), pending_lengths.data(), row_count * sizeof(uint32_t));
+		memcpy(frame_buffer.data() + row_count * sizeof(uint32_t), pending_data.data(), pending_size);
+
+		auto compressed_size =
+		    duckdb_zstd::ZSTD_compressCCtx(compression_context, compress_buffer.data(), compress_buffer.size(),
+		                                   frame_buffer.data(), frame_buffer.size(), ZSTDStorage::COMPRESSION_LEVEL);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("ZSTD compression failed: %s", duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		if (RequiredSegmentSize(compressed_size) > info.GetBlockSize()) {
+			// the frame does not fit into this segment anymore: continue in a new segment
+			FlushSegment();
+			if (RequiredSegmentSize(compressed_size) > info.GetBlockSize()) {
+				throw InternalException("ZSTD compression failed due to insufficient space in empty block");
+			}
+		}
+
+		// write the frame into the segment
+		zstd_frame_entry_t entry;
+		entry.row_start = UnsafeNumericCast<uint32_t>(current_segment->count.load());
+		entry.frame_offset = UnsafeNumericCast<uint32_t>(segment_data_end);
+		entry.compressed_size = UnsafeNumericCast<uint32_t>(compressed_size);
+		entry.uncompressed_size = UnsafeNumericCast<uint32_t>(frame_buffer.size());
+		memcpy(current_handle.Ptr() + segment_data_end, compress_buffer.data(), compressed_size);
+		segment_data_end += compressed_size;
+		directory.push_back(entry);
+
+		// the statistics are only updated now that we know the segment the frame ends up in
+		idx_t string_offset = 0;
+		for (idx_t i = 0; i < row_count; i++) {
+			if (!pending_validity[i]) {
+				continue;
+			}
+			string_t str(pending_data.data() + string_offset, pending_lengths[i]);
+			UncompressedStringStorage::UpdateStringStats(current_segment->stats, str);
+			string_offset += pending_lengths[i];
+		}
+		current_segment->count += row_count;
+
+		pending_lengths.clear();
+		pending_validity.clear();
+		pending_data.clear();
+		pending_size = 0;
+	}
+
+	void FlushSegment(bool final = false) {
+		auto next_start = current_segment->start + current_segment->count;
+
+		// write the directory behind the frames, and the header
+		auto base_ptr = current_handle.Ptr();
+		auto directory_offset = AlignValue<idx_t, sizeof(uint32_t)>(segment_data_end);
+		if (!directory.empty()) {
+			memcpy(base_ptr + directory_offset, directory.data(), directory.size() * sizeof(zstd_frame_entry_t));
+		}
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(directory.size()), data_ptr_cast(&header_ptr->frame_count));
+		Store<uint32_t>(UnsafeNumericCast<uint32_t>(directory_offset), data_ptr_cast(&header_ptr->directory_offset));
+		auto segment_size = directory_offset + directory.size() * sizeof(zstd_frame_entry_t);
+
+		current_handle.Destroy();
+		auto &state = checkpointer.GetCheckpointState();
+		state.FlushSegment(std::move(current_segment), segment_size);
+
+		if (!final) {
+			CreateEmptySegment(next_start);
+		}
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment(true);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+
+	// State regarding current segment
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle current_handle;
+	vector<zstd_frame_entry_t> directory;
+	idx_t segment_data_end;
+
+	// The rows of the frame that is currently being assembled
+	idx_t frame_size_limit;
+	vector<uint32_t> pending_lengths;
+	vector<bool> pending_validity;
+	string pending_data;
+	idx_t pending_size;
+
+	duckdb_zstd::ZSTD_CCtx *compression_context;
+	vector<data_t> frame_buffer;
+	vector<data_t> compress_buffer;
+};
+
+unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointer &checkpointer,
+                                                          unique_ptr<AnalyzeState> analyze_state_p) {
+	return make_uniq<ZSTDCompressionState>(checkpointer, analyze_state_p->info);
+}
+
+void ZSTDStorage::Compress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		state.AddString(data[idx], vdata.validity.RowIsValid(idx));
+	}
+}
+
+void ZSTDStorage::FinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressionState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public SegmentScanState {
+	ZSTDScanState() : current_frame(DConstants::INVALID_INDEX), frame_row_start(0), frame_row_count(0) {
+		decompression_context = duckdb_zstd::ZSTD_createDCtx();
+		if (!decompression_context) {
+			throw InternalException("ZSTD decompression failed to allocate a decompression context");
+		}
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(decompression_context);
+	}
+
+	BufferHandle handle;
+	//! The offset of the segment within the block (used to validate the cached frame when fetching rows)
+	idx_t segment_offset = DConstants::INVALID_INDEX;
+	//! The decompression context, which is re-used for all frames of the segment
+	duckdb_zstd::ZSTD_DCtx *decompression_context;
+
+	//! The decompressed frame that was scanned last
+	idx_t current_frame;
+	idx_t frame_row_start;
+	idx_t frame_row_count;
+	vector<data_t> frame_buffer;
+	//! The offsets of the strings within the decompressed frame
+	vector<uint32_t> string_offsets;
+
+	void LoadFrame(data_ptr_t base_ptr, idx_t frame_count, idx_t segment_count, idx_t frame_idx) {
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		auto directory_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->directory_offset));
+		auto directory = reinterpret_cast<zstd_frame_entry_t *>(base_ptr + directory_offset);
+		auto &entry = directory[frame_idx];
+		frame_buffer.resize(entry.uncompressed_size);
+		auto decompressed_size =
+		    duckdb_zstd::ZSTD_decompressDCtx(decompression_context, frame_buffer.data(), frame_buffer.size(),
+		                                     base_ptr + entry.frame_offset, entry.compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != entry.uncompressed_size) {
+			throw IOException("ZSTD decompression failed - corrupt segment?");
+		}
+		current_frame = frame_idx;
+		frame_row_start = entry.row_start;
+		auto frame_row_end = frame_idx + 1 < frame_count ? directory[frame_idx + 1].row_start : segment_count;
+		frame_row_count = frame_row_end - frame_row_start;
+
+		// prefix sum over the string lengths
+		auto lengths = reinterpret_cast<uint32_t *>(frame_buffer.data());
+		string_offsets.resize(frame_row_count + 1);
+		string_offsets[0] = UnsafeNumericCast<uint32_t>(frame_row_count * sizeof(uint32_t));
+		for (idx_t i = 0; i < frame_row_count; i++) {
+			string_offsets[i + 1] = string_offsets[i] + lengths[i];
+		}
+	}
+
+	string_t GetString(idx_t row) const {
+		D_ASSERT(row >= frame_row_start && row < frame_row_start + frame_row_count);
+		auto idx = row - frame_row_start;
+		auto length = string_offsets[idx + 1] - string_offsets[idx];
+		return string_t(const_char_ptr_cast(frame_buffer.data() + string_offsets[idx]), length);
+	}
+};
+
+idx_t ZSTDStorage::FindFrame(const zstd_frame_entry_t *directory, idx_t frame_count, idx_t row) {
+	// find the last frame that starts at or before the row
+	idx_t lower = 0;
+	idx_t upper = frame_count;
+	while (upper - lower > 1) {
+		auto middle = lower + (upper - lower) / 2;
+		if (directory[middle].row_start <= row) {
+			lower = middle;
+		} else {
+			upper = middle;
+		}
+	}
+	return lower;
+}
+
+unique_ptr<SegmentScanState> ZSTDStorage::StringInitScan(ColumnSegment &segment) {
+	auto state = make_uniq<ZSTDScanState>();
+	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+	state->handle = buffer_manager.Pin(segment.block);
+	return std::move(state);
+}
+
+void ZSTDStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                                   idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	auto frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+	auto directory =
+	    reinterpret_cast<zstd_frame_entry_t *>(base_ptr + Load<uint32_t>(data_ptr_cast(&header_ptr->directory_offset)));
+
+	auto result_data = FlatVector::GetData<string_t>(result);
+	idx_t scanned = 0;
+	while (scanned < scan_count) {
+		auto row = start + scanned;
+		if (scan_state.current_frame == DConstants::INVALID_INDEX || row < scan_state.frame_row_start ||
+		    row >= scan_state.frame_row_start + scan_state.frame_row_count) {
+			// the row is not in the cached frame: decompress the frame that contains it
+			auto frame_idx = FindFrame(directory, frame_count, row);
+			scan_state.LoadFrame(base_ptr, frame_count, segment.count, frame_idx);
+		}
+		auto frame_end = scan_state.frame_row_start + scan_state.frame_row_count;
+		auto count = MinValue<idx_t>(scan_count - scanned, frame_end - row);
+		for (idx_t i = 0; i < count; i++) {
+			auto str = scan_state.GetString(row + i);
+			result_data[result_offset + scanned + i] = StringVector::AddStringOrBlob(result, str);
+		}
+		scanned += count;
+	}
+}
+
+void ZSTDStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	StringScanPartial(segment, state, scan_count, result, 0);
+}
+
+void ZSTDStorage::StringSelect(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                               const SelectionVector &sel, idx_t sel_count) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	auto base_ptr = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+	auto frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+	auto directory =
+	    reinterpret_cast<zstd_frame_entry_t *>(base_ptr + Load<uint32_t>(data_ptr_cast(&header_ptr->directory_offset)));
+
+	// only the frames that contain selected rows are decompressed
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto row = start + sel.get_index(i);
+		if (scan_state.current_frame == DConstants::INVALID_INDEX || row < scan_state.frame_row_start ||
+		    row >= scan_state.frame_row_start + scan_state.frame_row_count) {
+			auto frame_idx = FindFrame(directory, frame_count, row);
+			scan_state.LoadFrame(base_ptr, frame_count, segment.count, frame_idx);
+		}
+		result_data[i] = StringVector::AddStringOrBlob(result, scan_state.GetString(row));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                                 idx_t result_idx) {
+	// the decompression context and the last decompressed frame are kept around for fetches of subsequent rows
+	auto &segment_state = state.segment_states[segment.block->BlockId()];
+	if (!segment_state) {
+		segment_state = make_uniq<ZSTDScanState>();
+	}
+	auto &scan_state = segment_state->Cast<ZSTDScanState>();
+	auto segment_offset = segment.GetBlockOffset();
+	if (scan_state.segment_offset != segment_offset) {
+		// a different segment within the same block - the cached frame cannot be used
+		scan_state.segment_offset = segment_offset;
+		scan_state.current_frame = DConstants::INVALID_INDEX;
+	}
+	auto &handle = state.GetOrInsertHandle(segment);
+	auto base_ptr = handle.Ptr() + segment_offset;
+
+	auto row = UnsafeNumericCast<idx_t>(row_id);
+	if (scan_state.current_frame == DConstants::INVALID_INDEX || row < scan_state.frame_row_start ||
+	    row >= scan_state.frame_row_start + scan_state.frame_row_count) {
+		auto header_ptr = reinterpret_cast<zstd_compression_header_t *>(base_ptr);
+		auto frame_count = Load<uint32_t>(data_ptr_cast(&header_ptr->frame_count));
+		auto directory_offset = Load<uint32_t>(data_ptr_cast(&header_ptr->directory_offset));
+		auto directory = reinterpret_cast<zstd_frame_entry_t *>(base_ptr + directory_offset);
+		scan_state.LoadFrame(base_ptr, frame_count, segment.count, FindFrame(directory, frame_count, row));
+	}
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = StringVector::AddStringOrBlob(result, scan_state.GetString(row));
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	auto function = CompressionFunction(
+	    CompressionType::COMPRESSION_ZSTD, data_type, ZSTDStorage::StringInitAnalyze, ZSTDStorage::StringAnalyze,
+	    ZSTDStorage::StringFinalAnalyze, ZSTDStorage::InitCompression, ZSTDStorage::Compress,
+	    ZSTDStorage::FinalizeCompress, ZSTDStorage::StringInitScan, ZSTDStorage::StringScan,
+	    ZSTDStorage::StringScanPartial, ZSTDStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.select = ZSTDStorage::StringSelect;
+	return function;
+}
+
+bool ZSTDFun::TypeIsSupported(const PhysicalType physical_type) {
+	return physical_type == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -30,6 +30,10 @@ MetaBlockPointer MetadataWriter::GetMetaBlockPointer() {
 	return manager.GetDiskPointer(block.pointer, UnsafeNumericCast<uint32_t>(offset));
 }
 
+void MetadataWriter::SetWrittenPointers(optional_ptr<vector<MetaBlockPointer>> written_pointers_p) {
+	written_pointers = written_pointers_p;
+}
+
 MetadataHandle MetadataWriter::NextHandle() {
 	return manager.AllocateHandle();
 }
@@ -19,7 +19,13 @@ OptimisticDataWriter::~OptimisticDataWriter() {
 
 bool OptimisticDataWriter::PrepareWrite() {
 	// check if we should pre-emptively write the table to disk
-	if (table.IsTemporary() || StorageManager::Get(table.GetAttached()).InMemory()) {
+	auto &storage_manager = StorageManager::Get(table.GetAttached());
+	if (table.IsTemporary() || storage_manager.InMemory()) {
+		return false;
+	}
+	if (!storage_manager.IsLoaded()) {
+		// we are replaying the WAL - later entries can delete the rows again (e.g., an UPDATE that rewrites the table)
+		// keep the rows in memory until the next checkpoint instead of allocating blocks for them on every replay
 		return false;
 	}
 	// we should! write the second-to-last row group to disk
@@ -546,12 +546,14 @@ TableFilterSet TableFilterSet::Deserialize(Deserializer &deserializer) {
 void VacuumOptions::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<bool>(100, "vacuum", vacuum);
 	serializer.WritePropertyWithDefault<bool>(101, "analyze", analyze);
+	serializer.WritePropertyWithDefault<bool>(102, "full", full);
 }
 
 VacuumOptions VacuumOptions::Deserialize(Deserializer &deserializer) {
 	VacuumOptions result;
 	deserializer.ReadPropertyWithDefault<bool>(100, "vacuum", result.vacuum);
 	deserializer.ReadPropertyWithDefault<bool>(101, "analyze", result.analyze);
+	deserializer.ReadPropertyWithDefault<bool>(102, "full", result.full);
 	return result;
 }
 
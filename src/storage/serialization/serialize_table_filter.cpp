@@ -10,6 +10,9 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 
 namespace duckdb {
 
@@ -21,6 +24,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	auto filter_type = deserializer.ReadProperty<TableFilterType>(100, "filter_type");
 	unique_ptr<TableFilter> result;
 	switch (filter_type) {
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::CONJUNCTION_AND:
 		result = ConjunctionAndFilter::Deserialize(deserializer);
 		break;
@@ -30,6 +36,12 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	case TableFilterType::CONSTANT_COMPARISON:
 		result = ConstantFilter::Deserialize(deserializer);
 		break;
+	case TableFilterType::DYNAMIC_FILTER:
+		result = DynamicFilter::Deserialize(deserializer);
+		break;
+	case TableFilterType::IN_FILTER:
+		result = InFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::IS_NOT_NULL:
 		result = IsNotNullFilter::Deserialize(deserializer);
 		break;
@@ -80,6 +92,17 @@ unique_ptr<TableFilter> ConstantFilter::Deserialize(Deserializer &deserializer)
 	return std::move(result);
 }
 
+void InFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WritePropertyWithDefault<vector<Value>>(200, "values", values);
+}
+
+unique_ptr<TableFilter> InFilter::Deserialize(Deserializer &deserializer) {
+	auto values = deserializer.ReadPropertyWithDefault<vector<Value>>(200, "values");
+	auto result = duckdb::unique_ptr<InFilter>(new InFilter(std::move(values)));
+	return std::move(result);
+}
+
 void IsNotNullFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 }
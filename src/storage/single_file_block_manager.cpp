@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/metadata/metadata_writer.hpp"
@@ -147,6 +148,10 @@ SingleFileBlockManager::SingleFileBlockManager(AttachedDatabase &db, const strin
       iteration_count(0), options(options) {
 }
 
+SingleFileBlockManager::~SingleFileBlockManager() {
+	StopReadAhead();
+}
+
 FileOpenFlags SingleFileBlockManager::GetFileFlags(bool create_new) const {
 	FileOpenFlags result;
 	if (options.read_only) {
@@ -468,6 +473,86 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	}
 }
 
+void SingleFileBlockManager::ReadAhead(vector<shared_ptr<BlockHandle>> &handles) {
+#ifndef DUCKDB_NO_THREADS
+	if (handles.empty()) {
+		return;
+	}
+	vector<weak_ptr<BlockHandle>> request;
+	for (auto &handle : handles) {
+		request.push_back(handle);
+	}
+	lock_guard<mutex> guard(read_ahead_lock);
+	if (read_ahead_shutdown || read_ahead_queue.size() >= MAX_READ_AHEAD_REQUESTS) {
+		// the scans are running too far ahead of the reads - drop the request
+		return;
+	}
+	read_ahead_queue.push_back(std::move(request));
+	if (!read_ahead_thread) {
+		read_ahead_thread = make_uniq<thread>([this]() { ReadAheadLoop(); });
+	}
+	read_ahead_cv.notify_one();
+#endif
+}
+
+void SingleFileBlockManager::ReadAheadLoop() {
+	while (true) {
+		vector<weak_ptr<BlockHandle>> request;
+		{
+			unique_lock<mutex> guard(read_ahead_lock);
+			read_ahead_cv.wait(guard, [&]() { return read_ahead_shutdown || !read_ahead_queue.empty(); });
+			if (read_ahead_shutdown) {
+				return;
+			}
+			request = std::move(read_ahead_queue.front());
+			read_ahead_queue.pop_front();
+		}
+		// gather the blocks that still exist and are not loaded yet
+		vector<shared_ptr<BlockHandle>> handles;
+		idx_t required_memory = 0;
+		for (auto &entry : request) {
+			auto handle = entry.lock();
+			if (!handle || !handle->IsUnloaded()) {
+				continue;
+			}
+			required_memory += handle->GetMemoryUsage();
+			handles.push_back(std::move(handle));
+		}
+		if (handles.empty()) {
+			continue;
+		}
+		if (buffer_manager.GetUsedMemory() + required_memory > buffer_manager.GetMaxMemory()) {
+			// reading these blocks would evict other blocks from the buffer pool - skip the request
+			continue;
+		}
+		try {
+			// load runs of adjacent blocks with a single read each
+			buffer_manager.Prefetch(handles);
+			// load any remaining blocks individually
+			for (auto &handle : handles) {
+				if (handle->IsUnloaded()) {
+					buffer_manager.Pin(handle);
+				}
+			}
+		} catch (...) {
+			// reading ahead is only a performance suggestion
+			// any error is thrown again when the scan reads the block itself
+		}
+	}
+}
+
+void SingleFileBlockManager::StopReadAhead() {
+	{
+		lock_guard<mutex> guard(read_ahead_lock);
+		read_ahead_shutdown = true;
+	}
+	read_ahead_cv.notify_all();
+	if (read_ahead_thread) {
+		read_ahead_thread->join();
+		read_ahead_thread.reset();
+	}
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	ChecksumAndWrite(buffer, BLOCK_START + NumericCast<idx_t>(block_id) * GetBlockAllocSize());
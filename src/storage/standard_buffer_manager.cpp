@@ -6,6 +6,7 @@
 #include "duckdb/common/set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/profiling_info.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -304,6 +305,11 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// the destructor calls Unpin, which grabs the BlockHandle's lock again, causing a deadlock
 	BufferHandle buf;
 
+	auto metrics = OperatorMetrics::Active();
+	if (metrics) {
+		metrics->buffer_pins++;
+	}
+
 	idx_t required_memory;
 	{
 		// lock the block
@@ -458,6 +464,11 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 	// WriteTemporaryBuffer assumes that we never write a buffer below DEFAULT_BLOCK_ALLOC_SIZE.
 	RequireTemporaryDirectory();
 
+	auto metrics = OperatorMetrics::Active();
+	if (metrics) {
+		metrics->spill_bytes += buffer.size;
+	}
+
 	// Append to a few grouped files.
 	if (buffer.size == GetBlockSize()) {
 		evicted_data_per_tag[uint8_t(tag)] += GetBlockSize();
@@ -559,6 +570,7 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -277,7 +277,9 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	// the WAL is synced to disk by the transaction manager after the commit, so that concurrent commits can share
+	// a single sync (group commit)
+	wal.WriteFlush();
 	state = WALCommitState::FLUSHED;
 }
 
@@ -297,11 +299,16 @@ void SingleFileStorageManager::CreateCheckpoint(CheckpointOptions options) {
 		db.GetStorageExtension()->OnCheckpointStart(db, options);
 	}
 	auto &config = DBConfig::Get(db);
-	if (GetWALSize() > 0 || config.options.force_checkpoint || options.action == CheckpointAction::FORCE_CHECKPOINT) {
+	if (GetWALSize() > 0 || checkpoint_requested || config.options.force_checkpoint ||
+	    options.action == CheckpointAction::FORCE_CHECKPOINT) {
 		// we only need to checkpoint if there is anything in the WAL
 		try {
 			SingleFileCheckpointWriter checkpointer(db, *block_manager, options.type);
 			checkpointer.CreateCheckpoint();
+			if (options.type == CheckpointType::FULL_CHECKPOINT) {
+				// concurrent checkpoints cannot rewrite tables - keep the request for the next full checkpoint
+				checkpoint_requested = false;
+			}
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			throw FatalException("Failed to create checkpoint because of error: %s", error.RawMessage());
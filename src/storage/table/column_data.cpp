@@ -132,10 +132,7 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 	}
 }
 
-idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
-	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
-		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
-	}
+void ColumnData::BeginScanVector(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (!state.initialized) {
 		D_ASSERT(state.current);
@@ -149,6 +146,13 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 		state.current->Skip(state);
 	}
 	D_ASSERT(state.current->type == type);
+}
+
+idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
+	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
+	}
+	BeginScanVector(state);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
 		D_ASSERT(state.row_index >= state.current->start &&
@@ -226,6 +230,15 @@ void ColumnData::UpdateInternal(TransactionData transaction, idx_t column_index,
 	updates->Update(transaction, column_index, update_vector, row_ids, update_count, base_vector);
 }
 
+void ColumnData::FilterVector(ColumnScanState &state, Vector &result, idx_t target_scan, SelectionVector &sel,
+                              idx_t &approved_tuple_count, const TableFilter &filter) {
+	BeginScanVector(state);
+	D_ASSERT(state.row_index + target_scan <= state.current->start + state.current->count);
+	state.current->Filter(state, target_scan, result, sel, approved_tuple_count, filter);
+	state.row_index += target_scan;
+	state.internal_index = state.row_index;
+}
+
 template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 idx_t ColumnData::ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                              idx_t target_scan) {
@@ -314,6 +327,29 @@ void ColumnData::FilterScanCommitted(idx_t vector_index, ColumnScanState &state,
 	result.Slice(sel, s_count);
 }
 
+bool ColumnData::CanScanSelection(ColumnScanState &state, idx_t target_scan, Vector &result) {
+	if (state.scan_options && state.scan_options->force_fetch_row) {
+		return false;
+	}
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	// the vector must be fully contained in the current segment, and there must not be any updates to merge
+	if (ColumnData::GetVectorScanType(state, target_scan) != ScanVectorType::SCAN_ENTIRE_VECTOR) {
+		return false;
+	}
+	return state.current->function.get().select != nullptr;
+}
+
+void ColumnData::ScanSelection(ColumnScanState &state, Vector &result, idx_t target_scan, const SelectionVector &sel,
+                               idx_t sel_count) {
+	BeginScanVector(state);
+	D_ASSERT(state.row_index + target_scan <= state.current->start + state.current->count);
+	state.current->Select(state, target_scan, result, sel, sel_count);
+	state.row_index += target_scan;
+	state.internal_index = state.row_index;
+}
+
 void ColumnData::Skip(ColumnScanState &state, idx_t s_count) {
 	state.Next(s_count);
 }
@@ -7,6 +7,18 @@
 
 namespace duckdb {
 
+//! Whether or not segments compressed with the method can be read by the storage version we are writing for
+//! Files written for older versions may not contain compression methods that were added later
+static bool CompressionTypeIsCompatible(CompressionType type, const SerializationCompatibility &compatibility) {
+	switch (type) {
+	case CompressionType::COMPRESSION_PFOR_DELTA:
+	case CompressionType::COMPRESSION_ZSTD:
+		return compatibility.Compare(4);
+	default:
+		return true;
+	}
+}
+
 ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup &row_group_p,
                                                ColumnCheckpointState &state_p, ColumnCheckpointInfo &checkpoint_info_p)
     : col_data(col_data_p), row_group(row_group_p), state(state_p),
@@ -17,6 +29,10 @@ ColumnDataCheckpointer::ColumnDataCheckpointer(ColumnData &col_data_p, RowGroup
 	auto &config = DBConfig::GetConfig(GetDatabase());
 	auto functions = config.GetCompressionFunctions(GetType().InternalType());
 	for (auto &func : functions) {
+		if (!CompressionTypeIsCompatible(func.get().type, config.options.serialization_compatibility)) {
+			// forcing a method that is not available falls back to the automatic selection
+			continue;
+		}
 		compression_functions.push_back(&func.get());
 	}
 }
@@ -109,6 +125,14 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method != CompressionType::COMPRESSION_ZSTD) {
+		// ZSTD trades scan speed for a better compression ratio, so it is only used when explicitly requested
+		for (auto &function : compression_functions) {
+			if (function && function->type == CompressionType::COMPRESSION_ZSTD) {
+				function = nullptr;
+			}
+		}
+	}
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
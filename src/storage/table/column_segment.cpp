@@ -1,11 +1,15 @@
 #include "duckdb/storage/table/column_segment.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/limits.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -139,6 +143,13 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+void ColumnSegment::Filter(ColumnScanState &state, idx_t scan_count, Vector &result, SelectionVector &sel,
+                           idx_t &approved_tuple_count, const TableFilter &filter) {
+	D_ASSERT(function.get().filter);
+	D_ASSERT(result.GetVectorType() == VectorType::FLAT_VECTOR);
+	function.get().filter(*this, state, scan_count, result, sel, approved_tuple_count, filter);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -345,6 +356,82 @@ static void FilterSelectionSwitch(UnifiedVectorFormat &vdata, T predicate, Selec
 	sel.Initialize(new_sel);
 }
 
+template <class T>
+static void TemplatedInSelection(UnifiedVectorFormat &vdata, const InFilter &filter, SelectionVector &sel,
+                                 idx_t &approved_tuple_count) {
+	// the IN list is sorted when the filter is created - binary search it for every row
+	auto in_list = FlatVector::GetData<T>(filter.sorted_values);
+	auto in_list_end = in_list + filter.values.size();
+	auto less_than = [](const T &left, const T &right) {
+		return LessThan::Operation<T>(left, right);
+	};
+
+	auto &mask = vdata.validity;
+	auto vec = UnifiedVectorFormat::GetData<T>(vdata);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto vector_idx = vdata.sel->get_index(idx);
+		bool found = mask.RowIsValid(vector_idx) &&
+		             std::binary_search(in_list, in_list_end, vec[vector_idx], less_than);
+		new_sel.set_index(result_count, idx);
+		result_count += found;
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+}
+
+static void InFilterSelectionSwitch(Vector &input, UnifiedVectorFormat &vdata, const InFilter &filter,
+                                    SelectionVector &sel, idx_t &approved_tuple_count) {
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::UINT8:
+		TemplatedInSelection<uint8_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedInSelection<uint16_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedInSelection<uint32_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedInSelection<uint64_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT8:
+		TemplatedInSelection<int8_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedInSelection<int16_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedInSelection<int32_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedInSelection<int64_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedInSelection<hugeint_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedInSelection<uhugeint_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedInSelection<float>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedInSelection<double>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::VARCHAR:
+		TemplatedInSelection<string_t>(vdata, filter, sel, approved_tuple_count);
+		break;
+	case PhysicalType::BOOL:
+		TemplatedInSelection<bool>(vdata, filter, sel, approved_tuple_count);
+		break;
+	default:
+		throw InvalidTypeException(input.GetType(), "Invalid type for IN filter pushed down to table comparison");
+	}
+}
+
 template <bool IS_NULL>
 static idx_t TemplatedNullSelection(UnifiedVectorFormat &vdata, SelectionVector &sel, idx_t &approved_tuple_count) {
 	auto &mask = vdata.validity;
@@ -372,6 +459,36 @@ static idx_t TemplatedNullSelection(UnifiedVectorFormat &vdata, SelectionVector
 	}
 }
 
+void ColumnSegment::Select(ColumnScanState &state, idx_t scan_count, Vector &result, const SelectionVector &sel,
+                           idx_t sel_count) {
+	D_ASSERT(function.get().select);
+	function.get().select(*this, state, scan_count, result, sel, sel_count);
+}
+
+bool ColumnSegment::CanFilterCompressed(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+	case TableFilterType::IN_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_OR:
+		return CanFilterCompressed(filter.Cast<ConjunctionOrFilter>().child_filters);
+	case TableFilterType::CONJUNCTION_AND:
+		return CanFilterCompressed(filter.Cast<ConjunctionAndFilter>().child_filters);
+	default:
+		return false;
+	}
+}
+
+bool ColumnSegment::CanFilterCompressed(const vector<unique_ptr<TableFilter>> &filters) {
+	for (auto &child_filter : filters) {
+		if (!CanFilterCompressed(*child_filter)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
                                      const TableFilter &filter, idx_t scan_count, idx_t &approved_tuple_count) {
 	switch (filter.filter_type) {
@@ -513,6 +630,22 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::IN_FILTER: {
+		auto &in_filter = filter.Cast<InFilter>();
+		InFilterSelectionSwitch(vector, vdata, in_filter, sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		approved_tuple_count = bloom_filter.Filter(vector, scan_count, sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		// scans evaluate a snapshot of the dynamic filters that is taken once per row group (see ScanFilter)
+		// a dynamic filter that remains in the snapshot has not been set yet - all rows pass
+		D_ASSERT(!filter.Cast<DynamicFilter>().filter_data);
+		return approved_tuple_count;
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -1,4 +1,6 @@
 #include "duckdb/storage/table/persistent_table_data.hpp"
+#include "duckdb/storage/checkpoint/table_data_reader.hpp"
+#include "duckdb/storage/metadata/metadata_reader.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 
 namespace duckdb {
@@ -9,4 +11,21 @@ PersistentTableData::PersistentTableData(idx_t column_count) : total_rows(0), ro
 PersistentTableData::~PersistentTableData() {
 }
 
+PersistentTableDataLoader::PersistentTableDataLoader(MetadataManager &metadata_manager, MetaBlockPointer table_pointer,
+                                                     vector<LogicalType> types_p)
+    : metadata_manager(metadata_manager), table_pointer(table_pointer), types(std::move(types_p)) {
+}
+
+PersistentTableData &PersistentTableDataLoader::Load() {
+	lock_guard<mutex> guard(load_lock);
+	if (!data) {
+		auto result = make_uniq<PersistentTableData>(types.size());
+		MetadataReader reader(metadata_manager, table_pointer);
+		TableDataReader data_reader(reader, types, *result);
+		data_reader.ReadTableData();
+		data = std::move(result);
+	}
+	return *data;
+}
+
 } // namespace duckdb
@@ -12,21 +12,25 @@
 #include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/profiling_info.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/row_version_manager.hpp"
+#include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/execution/index/bloom/bloom_index.hpp"
 
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), version_info(nullptr), allocation_size(0),
+      has_changes(true) {
 	Verify();
 }
 
@@ -45,13 +49,23 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 	}
 	this->deletes_pointers = std::move(pointer.deletes_pointers);
 	this->deletes_is_loaded = false;
+	this->has_changes = false;
+	// newer storage versions store the metadata blocks of the columns, so a checkpoint can re-use them without
+	// loading the columns
+	this->column_metadata_blocks = std::move(pointer.metadata_blocks);
+	this->has_metadata_blocks = !column_metadata_blocks.empty();
 
 	Verify();
 }
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
 	this->collection = collection_p;
+	if (new_start == start) {
+		// the row group keeps its position - there is no need to load and move the columns
+		return;
+	}
 	this->start = new_start;
+	this->has_changes = true;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
 	}
@@ -100,9 +114,14 @@ ColumnData &RowGroup::GetColumn(storage_t c) {
 	auto &metadata_manager = GetCollection().GetMetadataManager();
 	auto &types = GetCollection().GetTypes();
 	auto &block_pointer = column_pointers[c];
-	MetadataReader column_data_reader(metadata_manager, block_pointer);
+	vector<MetaBlockPointer> read_pointers;
+	MetadataReader column_data_reader(metadata_manager, block_pointer, &read_pointers);
 	this->columns[c] =
 	    ColumnData::Deserialize(GetBlockManager(), GetTableInfo(), c, start, column_data_reader, types[c]);
+	if (!has_metadata_blocks) {
+		// keep track of the metadata blocks of the column, so a checkpoint can re-use them if nothing changes
+		column_metadata_blocks.insert(column_metadata_blocks.end(), read_pointers.begin(), read_pointers.end());
+	}
 	is_loaded[c] = true;
 	if (this->columns[c]->count != this->count) {
 		throw InternalException("Corrupted database - loaded column with index %llu at row start %llu, count %llu did "
@@ -199,6 +218,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	ReadAhead(state);
 	return true;
 }
 
@@ -226,9 +246,56 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	ReadAhead(state);
 	return true;
 }
 
+void RowGroup::ReadAhead(CollectionScanState &state) {
+	auto &block_manager = GetBlockManager();
+	if (block_manager.InMemory() || !state.row_groups) {
+		return;
+	}
+	auto &config = DBConfig::GetConfig(GetCollection().GetAttached().GetDatabase());
+	auto read_ahead = config.options.storage_read_ahead;
+	if (read_ahead == 0) {
+		return;
+	}
+	auto &column_ids = state.GetColumnIds();
+	auto &filter_list = state.GetFilterInfo().GetFilterList();
+	auto &types = GetCollection().GetTypes();
+	auto row_group = state.row_groups->GetNextSegment(this);
+	for (idx_t i = 0; i < read_ahead && row_group; i++) {
+		if (row_group->start >= state.max_row) {
+			break;
+		}
+		// skip row groups that the scan is going to prune using the zonemaps
+		bool skip_row_group = false;
+		for (auto &entry : filter_list) {
+			auto &column = row_group->GetColumn(entry.table_column_index);
+			if (column.CheckZonemap(entry.GetFilter()) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				skip_row_group = true;
+				break;
+			}
+		}
+		if (!skip_row_group) {
+			// gather the blocks of all scanned columns of the row group and read them in the background
+			PrefetchState prefetch_state;
+			for (auto &column_id : column_ids) {
+				if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+					continue;
+				}
+				auto &column = row_group->GetColumn(column_id);
+				ColumnScanState column_state;
+				column_state.Initialize(types[column_id], &state.GetOptions());
+				column.InitializeScan(column_state);
+				column.InitializePrefetch(prefetch_state, column_state, row_group->count);
+			}
+			block_manager.ReadAhead(prefetch_state.blocks);
+		}
+		row_group = state.row_groups->GetNextSegment(row_group);
+	}
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -355,16 +422,37 @@ void RowGroup::NextVector(CollectionScanState &state) {
 	}
 }
 
+FilterPropagateResult RowGroup::CheckBloomIndexes(idx_t column_index, TableFilter &filter) {
+	if (start >= NumericCast<idx_t>(MAX_ROW_ID)) {
+		// transaction-local rows are not part of any index
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	GetTableInfo().GetIndexes().ScanBound<BloomIndex>([&](BloomIndex &bloom_index) {
+		result = bloom_index.CheckFilter(column_index, filter, start, count);
+		return result == FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	});
+	return result;
+}
+
 bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 	auto &filter_list = filters.GetFilterList();
 	// new row group - label all filters as up for grabs again
 	filters.CheckAllFilters();
 	for (idx_t i = 0; i < filter_list.size(); i++) {
 		auto &entry = filter_list[i];
-		auto &filter = entry.filter;
+		auto &filter = entry.GetFilter();
 		auto base_column_index = entry.table_column_index;
 		auto prune_result = GetColumn(base_column_index).CheckZonemap(filter);
+		if (prune_result == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			// the zonemap is inconclusive (e.g., for unsorted keys) - try the bloom indexes of the column
+			prune_result = CheckBloomIndexes(base_column_index, filter);
+		}
 		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			auto metrics = OperatorMetrics::Active();
+			if (metrics) {
+				metrics->row_groups_skipped++;
+			}
 			return false;
 		}
 		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
@@ -403,6 +491,9 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::IN_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -419,7 +510,7 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		}
 		auto column_idx = entry.scan_column_index;
 		auto base_column_idx = entry.table_column_index;
-		auto &filter = entry.filter;
+		auto &filter = entry.GetFilter();
 
 		auto prune_result = GetColumn(base_column_idx).CheckZonemap(state.column_scans[column_idx], filter);
 		if (prune_result != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
@@ -445,6 +536,10 @@ bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 		while (state.vector_index < target_vector_index) {
 			NextVector(state);
 		}
+		auto metrics = OperatorMetrics::Active();
+		if (metrics) {
+			metrics->segments_skipped++;
+		}
 		return false;
 	}
 
@@ -555,7 +650,7 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					auto scan_idx = filter.scan_column_index;
 					auto &col_data = GetColumn(filter.table_column_index);
 					col_data.Select(transaction, state.vector_index, state.column_scans[scan_idx],
-					                result.data[scan_idx], sel, approved_tuple_count, filter.filter);
+					                result.data[scan_idx], sel, approved_tuple_count, filter.GetFilter());
 				}
 				for (auto &table_filter : filter_list) {
 					if (table_filter.IsAlwaysTrue()) {
@@ -563,6 +658,10 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 					}
 					result.data[table_filter.scan_column_index].Slice(sel, approved_tuple_count);
 				}
+				auto metrics = OperatorMetrics::Active();
+				if (metrics) {
+					metrics->rows_filtered += count - approved_tuple_count;
+				}
 			}
 			if (approved_tuple_count == 0) {
 				// all rows were filtered out by the table filters
@@ -770,6 +869,7 @@ void RowGroup::CommitAppend(transaction_t commit_id, idx_t row_group_start, idx_
 }
 
 void RowGroup::RevertAppend(idx_t row_group_start) {
+	has_changes = true;
 	auto &vinfo = GetOrCreateVersionInfo();
 	vinfo.RevertAppend(row_group_start - this->start);
 	for (auto &column : columns) {
@@ -780,6 +880,7 @@ void RowGroup::RevertAppend(idx_t row_group_start) {
 }
 
 void RowGroup::InitializeAppend(RowGroupAppendState &append_state) {
+	has_changes = true;
 	append_state.row_group = this;
 	append_state.offset_in_row_group = this->count;
 	// for each column, initialize the append state
@@ -809,6 +910,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		D_ASSERT(ids[i] >= row_t(this->start) && ids[i] < row_t(this->start + this->count));
 	}
 #endif
+	has_changes = true;
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
 		D_ASSERT(column.index != COLUMN_IDENTIFIER_ROW_ID);
@@ -833,6 +935,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	auto primary_column_idx = column_path[0];
 	D_ASSERT(primary_column_idx != COLUMN_IDENTIFIER_ROW_ID);
 	D_ASSERT(primary_column_idx < columns.size());
+	has_changes = true;
 	auto &col_data = GetColumn(primary_column_idx);
 	col_data.UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *col_data.GetUpdateStatistics());
@@ -920,9 +1023,24 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	return WriteToDisk(info);
 }
 
+bool RowGroup::HasChanges() const {
+	return has_changes || column_pointers.empty();
+}
+
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
                                      TableStatistics &global_stats) {
 	RowGroupPointer row_group_pointer;
+	row_group_pointer.row_start = start;
+	row_group_pointer.tuple_count = count;
+	if (!HasChanges()) {
+		// the columns have not changed since they were written: re-use the column data and metadata as-is
+		// their statistics are already part of the global statistics
+		D_ASSERT(write_data.states.empty());
+		CheckpointColumnPointers(writer.GetPayloadWriter().GetManager(), row_group_pointer);
+		row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+		Verify();
+		return row_group_pointer;
+	}
 
 	auto lock = global_stats.GetLock();
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -931,8 +1049,7 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 
 	// construct the row group pointer and write the column meta data to disk
 	D_ASSERT(write_data.states.size() == columns.size());
-	row_group_pointer.row_start = start;
-	row_group_pointer.tuple_count = count;
+	vector<MetaBlockPointer> written_blocks;
 	for (auto &state : write_data.states) {
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
@@ -940,21 +1057,50 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 
 		// store the stats and the data pointers in the row group pointers
 		row_group_pointer.data_pointers.push_back(pointer);
+		written_blocks.push_back(pointer);
 
 		// Write pointers to the column segments.
 		//
 		// Just as above, the state can refer to many other states, so this
 		// can cascade recursively into more pointer writes.
+		data_writer.SetWrittenPointers(&written_blocks);
 		BinarySerializer serializer(data_writer);
 		serializer.Begin();
 		state->WriteDataPointers(writer, serializer);
 		serializer.End();
+		data_writer.SetWrittenPointers(nullptr);
 	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+
+	// the next checkpoint can re-use the written column pointers, unless the columns change in the meantime
+	row_group_pointer.metadata_blocks = written_blocks;
+	column_pointers = row_group_pointer.data_pointers;
+	{
+		lock_guard<mutex> l(row_group_lock);
+		column_metadata_blocks = std::move(written_blocks);
+		has_metadata_blocks = true;
+	}
+	has_changes = false;
 	Verify();
 	return row_group_pointer;
 }
 
+void RowGroup::CheckpointColumnPointers(MetadataManager &manager, RowGroupPointer &row_group_pointer) {
+	if (!has_metadata_blocks) {
+		// the row group was written by an older storage version that does not store its metadata blocks
+		// we only know the metadata blocks of the columns that have been loaded - load the remaining ones
+		for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+			GetColumn(column_idx);
+		}
+	}
+	lock_guard<mutex> l(row_group_lock);
+	has_metadata_blocks = true;
+	// ensure the blocks we are pointing to are not marked as free
+	manager.ClearModifiedBlocks(column_metadata_blocks);
+	row_group_pointer.data_pointers = column_pointers;
+	row_group_pointer.metadata_blocks = column_metadata_blocks;
+}
+
 vector<MetaBlockPointer> RowGroup::CheckpointDeletes(MetadataManager &manager) {
 	if (HasUnloadedDeletes()) {
 		// deletes were not loaded so they cannot be changed
@@ -975,6 +1121,9 @@ void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
 	serializer.WriteProperty(101, "tuple_count", pointer.tuple_count);
 	serializer.WriteProperty(102, "data_pointers", pointer.data_pointers);
 	serializer.WriteProperty(103, "delete_pointers", pointer.deletes_pointers);
+	if (serializer.ShouldSerialize(4)) {
+		serializer.WritePropertyWithDefault(104, "metadata_blocks", pointer.metadata_blocks);
+	}
 }
 
 RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
@@ -983,6 +1132,7 @@ RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
 	result.tuple_count = deserializer.ReadProperty<uint64_t>(101, "tuple_count");
 	result.data_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(102, "data_pointers");
 	result.deletes_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(103, "delete_pointers");
+	result.metadata_blocks = deserializer.ReadPropertyWithDefault<vector<MetaBlockPointer>>(104, "metadata_blocks");
 	return result;
 }
 
@@ -15,6 +15,9 @@
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -27,15 +30,21 @@ RowGroupSegmentTree::RowGroupSegmentTree(RowGroupCollection &collection)
 RowGroupSegmentTree::~RowGroupSegmentTree() {
 }
 
-void RowGroupSegmentTree::Initialize(PersistentTableData &data) {
-	D_ASSERT(data.row_group_count > 0);
+void RowGroupSegmentTree::Initialize(shared_ptr<PersistentTableDataLoader> loader_p) {
 	current_row_group = 0;
-	max_row_group = data.row_group_count;
+	max_row_group = 0;
 	finished_loading = false;
-	reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
+	loader = std::move(loader_p);
 }
 
 unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
+	if (loader) {
+		// the row group pointers are stored after the table statistics
+		auto &data = loader->Load();
+		max_row_group = data.row_group_count;
+		reader = make_uniq<MetadataReader>(collection.GetMetadataManager(), data.block_pointer);
+		loader.reset();
+	}
 	if (current_row_group >= max_row_group) {
 		reader.reset();
 		finished_loading = true;
@@ -86,8 +95,10 @@ void RowGroupCollection::Initialize(PersistentTableData &data) {
 	D_ASSERT(this->row_start == 0);
 	auto l = row_groups->Lock();
 	this->total_rows = data.total_rows;
-	row_groups->Initialize(data);
-	stats.Initialize(types, data);
+	// the statistics and row group pointers are read on first access
+	auto loader = make_shared_ptr<PersistentTableDataLoader>(GetMetadataManager(), data.table_pointer, types);
+	row_groups->Initialize(loader);
+	stats.Initialize(std::move(loader));
 }
 
 void RowGroupCollection::InitializeEmpty() {
@@ -645,6 +656,10 @@ public:
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
+		if (!row_group.HasChanges()) {
+			// the row group is unchanged since it was last written - it does not need to be written again
+			return;
+		}
 		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
 	}
 
@@ -660,6 +675,16 @@ struct VacuumState {
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! The physical indexes of the columns the table is clustered on
+	vector<column_t> order_by;
+	//! The row groups starting at this index are sorted on the clustering key instead of being vacuumed
+	idx_t cluster_start = 0;
+	//! The number of rows in the row groups that are sorted
+	idx_t cluster_rows = 0;
+	//! The sort state shared by the tasks that sort the clustered row groups
+	unique_ptr<GlobalSortState> cluster_sort;
+	//! The number of clustered row groups that have not been sorted yet
+	atomic<idx_t> cluster_tasks_remaining {0};
 };
 
 class VacuumTask : public BaseCheckpointTask {
@@ -776,8 +801,165 @@ private:
 	idx_t row_start;
 };
 
+//===--------------------------------------------------------------------===//
+// Cluster
+//===--------------------------------------------------------------------===//
+class ClusterWriteTask : public BaseCheckpointTask {
+public:
+	ClusterWriteTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t row_start)
+	    : BaseCheckpointTask(checkpoint_state), vacuum_state(vacuum_state), row_start(row_start) {
+	}
+
+	void ExecuteTask() override {
+		auto &collection = checkpoint_state.collection;
+		auto &types = collection.GetTypes();
+		auto &buffer_manager = BufferManager::GetBufferManager(collection.GetAttached());
+
+		// all row groups have been sorted - merge the sorted runs
+		auto &global_sort = *vacuum_state.cluster_sort;
+		global_sort.PrepareMergePhase();
+		while (global_sort.sorted_blocks.size() > 1) {
+			global_sort.InitializeMergeRound();
+			MergeSorter merge_sorter(global_sort, buffer_manager);
+			merge_sorter.PerformInMergeRound();
+			global_sort.CompleteMergeRound(false);
+		}
+
+		// write the sorted rows to a new set of (full) row groups
+		DataChunk scan_chunk;
+		scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
+		idx_t target_idx = vacuum_state.cluster_start;
+		idx_t row_start = this->row_start;
+		idx_t remaining_rows = vacuum_state.cluster_rows;
+		idx_t row_group_remaining = 0;
+		unique_ptr<RowGroup> row_group;
+		TableAppendState append_state;
+		PayloadScanner scanner(global_sort);
+		while (scanner.Remaining()) {
+			scan_chunk.Reset();
+			scanner.Scan(scan_chunk);
+			idx_t remaining = scan_chunk.size();
+			while (remaining > 0) {
+				if (row_group_remaining == 0) {
+					if (row_group) {
+						FinalizeRowGroup(std::move(row_group), target_idx++);
+					}
+					row_group_remaining = MinValue<idx_t>(remaining_rows, Storage::ROW_GROUP_SIZE);
+					row_group = make_uniq<RowGroup>(collection, row_start, row_group_remaining);
+					row_group->InitializeEmpty(types);
+					row_group->InitializeAppend(append_state.row_group_append_state);
+					row_start += row_group_remaining;
+					remaining_rows -= row_group_remaining;
+				}
+				idx_t append_count = MinValue<idx_t>(remaining, row_group_remaining);
+				row_group->Append(append_state.row_group_append_state, scan_chunk, append_count);
+				row_group_remaining -= append_count;
+				remaining -= append_count;
+				if (remaining > 0) {
+					// slice chunk for the next append
+					scan_chunk.Slice(append_count, remaining);
+				}
+			}
+		}
+		if (row_group) {
+			FinalizeRowGroup(std::move(row_group), target_idx++);
+		}
+		if (remaining_rows != 0 || row_group_remaining != 0) {
+			throw InternalException("Mismatch in row group count vs sorted count in RowGroupCollection::Checkpoint");
+		}
+		vacuum_state.cluster_sort.reset();
+		// sorting is complete - schedule checkpoint tasks of the target row groups
+		for (idx_t i = vacuum_state.cluster_start; i < target_idx; i++) {
+			collection.ScheduleCheckpointTask(checkpoint_state, i);
+		}
+	}
+
+private:
+	void FinalizeRowGroup(unique_ptr<RowGroup> row_group, idx_t target_idx) {
+		row_group->Verify();
+		// row groups never grow while sorting, so the sorted rows always fit in the original segments
+		D_ASSERT(target_idx < checkpoint_state.segments.size() && !checkpoint_state.segments[target_idx].node);
+		checkpoint_state.segments[target_idx].node = std::move(row_group);
+	}
+
+private:
+	VacuumState &vacuum_state;
+	//! The first row id of the sorted row groups
+	idx_t row_start;
+};
+
+class ClusterSortTask : public BaseCheckpointTask {
+public:
+	ClusterSortTask(CollectionCheckpointState &checkpoint_state, VacuumState &vacuum_state, idx_t segment_idx,
+	                idx_t row_start)
+	    : BaseCheckpointTask(checkpoint_state), vacuum_state(vacuum_state), segment_idx(segment_idx),
+	      row_start(row_start) {
+	}
+
+	void ExecuteTask() override {
+		auto &collection = checkpoint_state.collection;
+		auto &types = collection.GetTypes();
+		auto &buffer_manager = BufferManager::GetBufferManager(collection.GetAttached());
+
+		// sort the rows of this row group on the clustering key, carrying all columns as the payload
+		auto &global_sort = *vacuum_state.cluster_sort;
+		LocalSortState local_sort;
+		local_sort.Initialize(global_sort, buffer_manager);
+
+		DataChunk scan_chunk;
+		scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
+		DataChunk key_chunk;
+		vector<LogicalType> key_types;
+		for (auto &column_idx : vacuum_state.order_by) {
+			key_types.push_back(types[column_idx]);
+		}
+		key_chunk.InitializeEmpty(key_types);
+
+		vector<column_t> column_ids;
+		for (idx_t c = 0; c < types.size(); c++) {
+			column_ids.push_back(c);
+		}
+		TableScanState scan_state;
+		scan_state.Initialize(column_ids);
+		scan_state.table_state.Initialize(types);
+		scan_state.table_state.max_row = idx_t(-1);
+		auto &current_row_group = *checkpoint_state.segments[segment_idx].node;
+		current_row_group.InitializeScan(scan_state.table_state);
+		while (true) {
+			scan_chunk.Reset();
+			current_row_group.ScanCommitted(scan_state.table_state, scan_chunk,
+			                                TableScanType::TABLE_SCAN_LATEST_COMMITTED_ROWS);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			for (idx_t i = 0; i < vacuum_state.order_by.size(); i++) {
+				key_chunk.data[i].Reference(scan_chunk.data[vacuum_state.order_by[i]]);
+			}
+			key_chunk.SetCardinality(scan_chunk);
+			local_sort.SinkChunk(key_chunk, scan_chunk);
+		}
+		global_sort.AddLocalState(local_sort);
+		// drop the row group after sorting
+		current_row_group.CommitDrop();
+		checkpoint_state.segments[segment_idx].node.reset();
+
+		if (--vacuum_state.cluster_tasks_remaining == 0) {
+			// this was the last row group to be sorted - merge and write the sorted rows in a separate task
+			auto write_task = make_uniq<ClusterWriteTask>(checkpoint_state, vacuum_state, row_start);
+			checkpoint_state.executor.ScheduleTask(std::move(write_task));
+		}
+	}
+
+private:
+	VacuumState &vacuum_state;
+	idx_t segment_idx;
+	//! The first row id of the sorted row groups
+	idx_t row_start;
+};
+
 void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
                                                vector<SegmentNode<RowGroup>> &segments) {
+	state.cluster_start = segments.size();
 	bool is_full_checkpoint = checkpoint_state.writer.GetCheckpointType() == CheckpointType::FULL_CHECKPOINT;
 	// currently we can only vacuum deletes if we are doing a full checkpoint and there are no indexes
 	state.can_vacuum_deletes = info->GetIndexes().Empty() && is_full_checkpoint;
@@ -796,6 +978,35 @@ void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkp
 		}
 		state.row_group_counts.push_back(row_group_count);
 	}
+	// clustered tables: sort the row groups that were changed since the last checkpoint on the clustering key
+	// this re-orders rows and changes their row ids - which is only safe under the same conditions as vacuuming
+	state.order_by = checkpoint_state.writer.GetOrderByColumns();
+	if (state.order_by.empty()) {
+		return;
+	}
+	idx_t cluster_start = segments.size();
+	if (info->GetRecluster()) {
+		// VACUUM FULL: sort all row groups
+		cluster_start = 0;
+	} else {
+		// rows are only appended at the end of the table - sort the trailing row groups that have changes
+		while (cluster_start > 0) {
+			auto &entry = segments[cluster_start - 1];
+			if (entry.node && !entry.node->HasChanges()) {
+				break;
+			}
+			cluster_start--;
+		}
+	}
+	idx_t cluster_rows = 0;
+	for (idx_t segment_idx = cluster_start; segment_idx < segments.size(); segment_idx++) {
+		cluster_rows += state.row_group_counts[segment_idx];
+	}
+	if (cluster_rows == 0) {
+		return;
+	}
+	state.cluster_start = cluster_start;
+	state.cluster_rows = cluster_rows;
 }
 
 bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state,
@@ -830,7 +1041,7 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		auto total_target_size = target_count * Storage::ROW_GROUP_SIZE;
 		merge_count = 0;
 		merge_rows = 0;
-		for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
+		for (next_idx = segment_idx; next_idx < state.cluster_start; next_idx++) {
 			if (state.row_group_counts[next_idx] == 0) {
 				continue;
 			}
@@ -865,6 +1076,35 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
+void RowGroupCollection::ScheduleClusterTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state) {
+	auto &types = GetTypes();
+	auto &buffer_manager = BufferManager::GetBufferManager(GetAttached());
+	// the clustering key columns are referenced by their position in the sort key chunk
+	vector<BoundOrderByNode> orders;
+	for (idx_t i = 0; i < state.order_by.size(); i++) {
+		auto &key_type = types[state.order_by[i]];
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(key_type, i));
+	}
+	RowLayout payload_layout;
+	payload_layout.Initialize(types);
+	state.cluster_sort = make_uniq<GlobalSortState>(buffer_manager, orders, payload_layout);
+
+	// every row group is sorted by its own task - the last task to finish schedules the merge
+	vector<idx_t> sort_segments;
+	for (idx_t segment_idx = state.cluster_start; segment_idx < checkpoint_state.segments.size(); segment_idx++) {
+		if (state.row_group_counts[segment_idx] == 0) {
+			continue;
+		}
+		sort_segments.push_back(segment_idx);
+	}
+	state.cluster_tasks_remaining = sort_segments.size();
+	for (auto &segment_idx : sort_segments) {
+		auto sort_task = make_uniq<ClusterSortTask>(checkpoint_state, state, segment_idx, state.row_start);
+		checkpoint_state.executor.ScheduleTask(std::move(sort_task));
+	}
+}
+
 void RowGroupCollection::ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx) {
 	auto checkpoint_task = make_uniq<CheckpointTask>(checkpoint_state, segment_idx);
 	checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
@@ -881,6 +1121,12 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	// schedule tasks
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
+		if (segment_idx == vacuum_state.cluster_start) {
+			// the remaining row groups are sorted on the clustering key and rewritten in clustering order
+			ScheduleClusterTasks(checkpoint_state, vacuum_state);
+			vacuum_state.row_start += vacuum_state.cluster_rows;
+			break;
+		}
 		auto vacuum_tasks = ScheduleVacuumTasks(checkpoint_state, vacuum_state, segment_idx);
 		if (vacuum_tasks) {
 			// vacuum tasks were scheduled - don't schedule a checkpoint task yet
@@ -918,6 +1164,9 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		new_total_rows += row_group.count;
 	}
 	total_rows = new_total_rows;
+	if (vacuum_state.can_vacuum_deletes) {
+		info->SetRecluster(false);
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -1,6 +1,9 @@
 #include "duckdb/storage/table/scan_state.hpp"
 
 #include "duckdb/execution/adaptive_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/row_group.hpp"
@@ -35,8 +38,75 @@ ScanFilterInfo &TableScanState::GetFilterInfo() {
 	return filters;
 }
 
+static bool ContainsDynamicFilter(const TableFilter &filter);
+
+static bool ContainsDynamicFilter(const vector<unique_ptr<TableFilter>> &child_filters) {
+	for (auto &child_filter : child_filters) {
+		if (ContainsDynamicFilter(*child_filter)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool ContainsDynamicFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::DYNAMIC_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND:
+		return ContainsDynamicFilter(filter.Cast<ConjunctionAndFilter>().child_filters);
+	case TableFilterType::CONJUNCTION_OR:
+		return ContainsDynamicFilter(filter.Cast<ConjunctionOrFilter>().child_filters);
+	case TableFilterType::STRUCT_EXTRACT:
+		return ContainsDynamicFilter(*filter.Cast<StructFilter>().child_filter);
+	default:
+		return false;
+	}
+}
+
+//! Copies the filter, replacing every dynamic filter with a copy of its current state
+static unique_ptr<TableFilter> CopyDynamicFilterState(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &dynamic_filter = filter.Cast<DynamicFilter>();
+		if (dynamic_filter.filter_data) {
+			lock_guard<mutex> l(dynamic_filter.filter_data->lock);
+			if (dynamic_filter.filter_data->initialized) {
+				return dynamic_filter.filter_data->filter->Copy();
+			}
+		}
+		// the filter has not been set yet - a dynamic filter without state does not remove any rows
+		return make_uniq<DynamicFilter>();
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto result = make_uniq<ConjunctionAndFilter>();
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			result->child_filters.push_back(CopyDynamicFilterState(*child_filter));
+		}
+		return std::move(result);
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto result = make_uniq<ConjunctionOrFilter>();
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			result->child_filters.push_back(CopyDynamicFilterState(*child_filter));
+		}
+		return std::move(result);
+	}
+	case TableFilterType::STRUCT_EXTRACT: {
+		auto &struct_filter = filter.Cast<StructFilter>();
+		return make_uniq<StructFilter>(struct_filter.child_idx, struct_filter.child_name,
+		                               CopyDynamicFilterState(*struct_filter.child_filter));
+	}
+	default:
+		return filter.Copy();
+	}
+}
+
 ScanFilter::ScanFilter(idx_t index, const vector<column_t> &column_ids, TableFilter &filter)
     : scan_column_index(index), table_column_index(column_ids[index]), filter(filter), always_true(false) {
+	if (ContainsDynamicFilter(filter)) {
+		dynamic_filter_snapshot = CopyDynamicFilterState(filter);
+	}
 }
 
 void ScanFilterInfo::Initialize(TableFilterSet &filters, const vector<column_t> &column_ids) {
@@ -81,6 +151,10 @@ void ScanFilterInfo::CheckAllFilters() {
 	// set "always_true" in the individual filters to false
 	for (auto &filter : filter_list) {
 		filter.always_true = false;
+		if (filter.dynamic_filter_snapshot) {
+			// pick up the latest state of the dynamic filters for the next row group
+			filter.dynamic_filter_snapshot = CopyDynamicFilterState(filter.filter);
+		}
 	}
 }
 
@@ -76,6 +76,35 @@ idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                Vector &result, SelectionVector &sel, idx_t &count, const TableFilter &filter) {
+	// we can only evaluate the filter on the compressed data if the entire vector comes from a single segment
+	// without any updates, and the compression method of that segment supports it
+	auto target_count = GetVectorCount(vector_index);
+	if (ColumnData::GetVectorScanType(state, target_count) != ScanVectorType::SCAN_ENTIRE_VECTOR ||
+	    !state.current->function.get().filter || result.GetVectorType() != VectorType::FLAT_VECTOR ||
+	    (state.scan_options && state.scan_options->force_fetch_row) || !ColumnSegment::CanFilterCompressed(filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, count, filter);
+		return;
+	}
+	// scan the validity first: NULL values never pass the filter
+	validity.Scan(transaction, vector_index, state.child_states[0], result, target_count);
+	FilterVector(state, result, target_count, sel, count, filter);
+}
+
+void StandardColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                    Vector &result, SelectionVector &sel, idx_t count) {
+	// late materialization: if both the data and the validity support it, only decompress the selected rows
+	auto target_count = GetVectorCount(vector_index);
+	if (count == target_count || !CanScanSelection(state, target_count, result) ||
+	    !validity.CanScanSelection(state.child_states[0], target_count, result)) {
+		ColumnData::FilterScan(transaction, vector_index, state, result, sel, count);
+		return;
+	}
+	ScanSelection(state, result, target_count, sel, count);
+	validity.ScanSelection(state.child_states[0], result, target_count, sel, count);
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 	ColumnAppendState child_append;
@@ -6,14 +6,20 @@
 
 namespace duckdb {
 
-void TableStatistics::Initialize(const vector<LogicalType> &types, PersistentTableData &data) {
+void TableStatistics::Initialize(shared_ptr<PersistentTableDataLoader> loader_p) {
 	D_ASSERT(Empty());
 
 	stats_lock = make_shared_ptr<mutex>();
+	loader = std::move(loader_p);
+}
+
+void TableStatistics::LoadStatistics() {
+	if (!loader) {
+		return;
+	}
+	auto &data = loader->Load();
 	column_stats = std::move(data.table_stats.column_stats);
-	if (column_stats.size() != types.size()) { // LCOV_EXCL_START
-		throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
-	} // LCOV_EXCL_STOP
+	loader.reset();
 }
 
 void TableStatistics::InitializeEmpty(const vector<LogicalType> &types) {
@@ -31,6 +37,7 @@ void TableStatistics::InitializeAddColumn(TableStatistics &parent, const Logical
 
 	stats_lock = parent.stats_lock;
 	lock_guard<mutex> lock(*stats_lock);
+	parent.LoadStatistics();
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		column_stats.push_back(parent.column_stats[i]);
 	}
@@ -43,6 +50,7 @@ void TableStatistics::InitializeRemoveColumn(TableStatistics &parent, idx_t remo
 
 	stats_lock = parent.stats_lock;
 	lock_guard<mutex> lock(*stats_lock);
+	parent.LoadStatistics();
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		if (i != removed_column) {
 			column_stats.push_back(parent.column_stats[i]);
@@ -56,6 +64,7 @@ void TableStatistics::InitializeAlterType(TableStatistics &parent, idx_t changed
 
 	stats_lock = parent.stats_lock;
 	lock_guard<mutex> lock(*stats_lock);
+	parent.LoadStatistics();
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		if (i == changed_idx) {
 			column_stats.push_back(ColumnStatistics::CreateEmptyStats(new_type));
@@ -71,6 +80,7 @@ void TableStatistics::InitializeAddConstraint(TableStatistics &parent) {
 
 	stats_lock = parent.stats_lock;
 	lock_guard<mutex> lock(*stats_lock);
+	parent.LoadStatistics();
 	for (idx_t i = 0; i < parent.column_stats.size(); i++) {
 		column_stats.push_back(parent.column_stats[i]);
 	}
@@ -102,6 +112,7 @@ ColumnStatistics &TableStatistics::GetStats(TableStatisticsLock &lock, idx_t i)
 
 unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 	lock_guard<mutex> l(*stats_lock);
+	LoadStatistics();
 	auto result = column_stats[i]->Statistics().Copy();
 	if (column_stats[i]->HasDistinctStats()) {
 		result.SetDistinctCount(column_stats[i]->DistinctStats().GetCount());
@@ -111,6 +122,7 @@ unique_ptr<BaseStatistics> TableStatistics::CopyStats(idx_t i) {
 
 void TableStatistics::CopyStats(TableStatistics &other) {
 	TableStatisticsLock lock(*stats_lock);
+	LoadStatistics();
 	CopyStats(lock, other);
 }
 
@@ -127,32 +139,34 @@ void TableStatistics::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", table_sample, nullptr);
 }
 
-void TableStatistics::Deserialize(Deserializer &deserializer, ColumnList &columns) {
-	auto physical_columns = columns.Physical();
-
-	auto iter = physical_columns.begin();
+void TableStatistics::Deserialize(Deserializer &deserializer, const vector<LogicalType> &types) {
 	deserializer.ReadList(100, "column_stats", [&](Deserializer::List &list, idx_t i) {
-		auto &col = *iter;
-		iter.operator++();
-
-		auto type = col.GetType();
+		if (i >= types.size()) { // LCOV_EXCL_START
+			throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
+		} // LCOV_EXCL_STOP
+		auto type = types[i];
 		deserializer.Set<LogicalType &>(type);
 
 		column_stats.push_back(list.ReadElement<shared_ptr<ColumnStatistics>>());
 
 		deserializer.Unset<LogicalType>();
 	});
+	if (column_stats.size() != types.size()) { // LCOV_EXCL_START
+		throw IOException("Table statistics column count is not aligned with table column count. Corrupt file?");
+	} // LCOV_EXCL_STOP
 	table_sample = deserializer.ReadPropertyWithDefault<unique_ptr<BlockingSample>>(101, "table_sample", nullptr);
 }
 
 unique_ptr<TableStatisticsLock> TableStatistics::GetLock() {
 	D_ASSERT(stats_lock);
-	return make_uniq<TableStatisticsLock>(*stats_lock);
+	auto lock = make_uniq<TableStatisticsLock>(*stats_lock);
+	LoadStatistics();
+	return lock;
 }
 
 bool TableStatistics::Empty() {
-	D_ASSERT(column_stats.empty() == (stats_lock.get() == nullptr));
-	return column_stats.empty();
+	D_ASSERT(loader || column_stats.empty() == (stats_lock.get() == nullptr));
+	return column_stats.empty() && !loader;
 }
 
 } // namespace duckdb
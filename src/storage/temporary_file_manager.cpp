@@ -1,17 +1,22 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+#include "zstd.h"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -57,8 +62,11 @@ bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
+idx_t BlockIndexManager::GetUsedBlockCount() {
+	return indexes_in_use.size();
+}
+
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +74,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -90,15 +98,159 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 	return index;
 }
 
+//===--------------------------------------------------------------------===//
+// CompressedTemporaryBuffer
+//===--------------------------------------------------------------------===//
+
+//! A low ZSTD compression level - compressing the evicted block must not take longer than writing it
+static constexpr int TEMPORARY_BUFFER_ZSTD_LEVEL = 1;
+
+idx_t CompressedTemporaryBuffer::GetSlotSize(idx_t size, idx_t block_alloc_size) {
+	auto size_class = block_alloc_size / SIZE_CLASS_COUNT;
+	auto slot_size = (size + size_class - 1) / size_class * size_class;
+	if (slot_size >= block_alloc_size) {
+		// the compressed block does not save any space on disk
+		return 0;
+	}
+	return slot_size;
+}
+
+//! Scratch space for compressing blocks and for reading compressed blocks back
+//! Every thread reuses its own space, instead of allocating memory outside of the buffer manager for every block
+struct TemporaryBufferScratch {
+	AllocatedData lz4;
+	AllocatedData zstd;
+	AllocatedData read;
+
+	static data_ptr_t Get(AllocatedData &space, idx_t size) {
+		if (space.GetSize() < size) {
+			space = Allocator::DefaultAllocator().Allocate(size);
+		}
+		return space.get();
+	}
+};
+
+static thread_local TemporaryBufferScratch temporary_buffer_scratch;
+
+static CompressedTemporaryBuffer FinalizeCompressedBuffer(TemporaryBufferCodec codec, AllocatedData &space,
+                                                          idx_t compressed_size, idx_t block_alloc_size) {
+	CompressedTemporaryBuffer result;
+	auto size = CompressedTemporaryBuffer::HEADER_SIZE + compressed_size;
+	if (CompressedTemporaryBuffer::GetSlotSize(size, block_alloc_size) == 0) {
+		// not worth compressing: write the block uncompressed
+		return result;
+	}
+	Store<idx_t>(static_cast<idx_t>(codec), space.get());
+	Store<idx_t>(compressed_size, space.get() + sizeof(idx_t));
+	result.codec = codec;
+	result.data = space.get();
+	result.size = size;
+	result.capacity = space.GetSize();
+	return result;
+}
+
+static CompressedTemporaryBuffer CompressLZ4(FileBuffer &buffer) {
+	auto source_size = NumericCast<int>(buffer.AllocSize());
+	auto bound = duckdb_lz4::LZ4_compressBound(source_size);
+	auto &space = temporary_buffer_scratch.lz4;
+	auto data =
+	    TemporaryBufferScratch::Get(space, CompressedTemporaryBuffer::HEADER_SIZE + NumericCast<idx_t>(bound));
+	auto target = data + CompressedTemporaryBuffer::HEADER_SIZE;
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(char_ptr_cast(buffer.InternalBuffer()),
+	                                                        char_ptr_cast(target), source_size, bound);
+	if (compressed_size <= 0) {
+		return CompressedTemporaryBuffer();
+	}
+	return FinalizeCompressedBuffer(TemporaryBufferCodec::LZ4, space, NumericCast<idx_t>(compressed_size),
+	                                buffer.AllocSize());
+}
+
+static CompressedTemporaryBuffer CompressZSTD(FileBuffer &buffer) {
+	auto source_size = buffer.AllocSize();
+	auto bound = duckdb_zstd::ZSTD_compressBound(source_size);
+	auto &space = temporary_buffer_scratch.zstd;
+	auto data = TemporaryBufferScratch::Get(space, CompressedTemporaryBuffer::HEADER_SIZE + bound);
+	auto compressed_size =
+	    duckdb_zstd::ZSTD_compress(data + CompressedTemporaryBuffer::HEADER_SIZE, bound, buffer.InternalBuffer(),
+	                               source_size, TEMPORARY_BUFFER_ZSTD_LEVEL);
+	if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+		return CompressedTemporaryBuffer();
+	}
+	return FinalizeCompressedBuffer(TemporaryBufferCodec::ZSTD, space, compressed_size, buffer.AllocSize());
+}
+
+CompressedTemporaryBuffer CompressedTemporaryBuffer::Compress(FileBuffer &buffer,
+                                                              TemporaryFileCompression compression) {
+	switch (compression) {
+	case TemporaryFileCompression::NONE:
+		return CompressedTemporaryBuffer();
+	case TemporaryFileCompression::LZ4:
+		return CompressLZ4(buffer);
+	case TemporaryFileCompression::ZSTD:
+		return CompressZSTD(buffer);
+	case TemporaryFileCompression::ADAPTIVE: {
+		// LZ4 is cheap - use it to find out whether the block compresses at all
+		auto result = CompressLZ4(buffer);
+		auto smallest_slot_size = buffer.AllocSize() / SIZE_CLASS_COUNT;
+		if (result.codec == TemporaryBufferCodec::UNCOMPRESSED || result.size <= smallest_slot_size) {
+			// incompressible, or already as small as it gets: ZSTD cannot save us any space on disk
+			return result;
+		}
+		// the block compresses - check if ZSTD moves it into a smaller slot
+		auto zstd_result = CompressZSTD(buffer);
+		if (zstd_result.codec != TemporaryBufferCodec::UNCOMPRESSED &&
+		    GetSlotSize(zstd_result.size, buffer.AllocSize()) < GetSlotSize(result.size, buffer.AllocSize())) {
+			return zstd_result;
+		}
+		return result;
+	}
+	default:
+		throw InternalException("Unknown TemporaryFileCompression");
+	}
+}
+
+void CompressedTemporaryBuffer::Decompress(const_data_ptr_t compressed, idx_t slot_size, FileBuffer &buffer) {
+	auto codec = static_cast<TemporaryBufferCodec>(Load<idx_t>(compressed));
+	auto compressed_size = Load<idx_t>(compressed + sizeof(idx_t));
+	if (HEADER_SIZE + compressed_size > slot_size) {
+		throw IOException("Corrupt compressed block in temporary file: compressed size exceeds the slot size");
+	}
+	auto source = compressed + HEADER_SIZE;
+	auto target_size = buffer.AllocSize();
+	switch (codec) {
+	case TemporaryBufferCodec::LZ4: {
+		auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(const_char_ptr_cast(source),
+		                                                         char_ptr_cast(buffer.InternalBuffer()),
+		                                                         NumericCast<int>(compressed_size),
+		                                                         NumericCast<int>(target_size));
+		if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != target_size) {
+			throw IOException("Corrupt compressed block in temporary file: LZ4 decompression failed");
+		}
+		break;
+	}
+	case TemporaryBufferCodec::ZSTD: {
+		auto decompressed_size =
+		    duckdb_zstd::ZSTD_decompress(buffer.InternalBuffer(), target_size, source, compressed_size);
+		if (duckdb_zstd::ZSTD_isError(decompressed_size) || decompressed_size != target_size) {
+			throw IOException("Corrupt compressed block in temporary file: ZSTD decompression failed");
+		}
+		break;
+	}
+	default:
+		throw IOException("Corrupt compressed block in temporary file: unknown codec %llu", static_cast<idx_t>(codec));
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+                                         idx_t index, TemporaryFileManager &manager, idx_t slot_size)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), slot_size(slot_size),
+      file_index(index),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -120,14 +272,37 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	D_ASSERT(!IsCompressed());
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(CompressedTemporaryBuffer &buffer, TemporaryFileIndex index) {
+	D_ASSERT(IsCompressed());
+	D_ASSERT(buffer.size <= slot_size && buffer.capacity >= slot_size);
+	// always write the full slot, so that reading the slot back never reads past the end of the file
+	memset(buffer.data + buffer.size, 0, slot_size - buffer.size);
+	handle->Write(buffer.data, slot_size, GetPositionInFile(index.block_index));
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (!IsCompressed()) {
+		auto position = GetPositionInFile(block_index);
+		auto block_size = buffer_manager.GetBlockSize();
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position, block_size,
+		                                                          std::move(reusable_buffer));
+	}
+	// read the compressed block and decompress it into a buffer of the regular block size
+	auto compressed = TemporaryBufferScratch::Get(temporary_buffer_scratch.read, slot_size);
+	handle->Read(compressed, slot_size, GetPositionInFile(block_index));
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	CompressedTemporaryBuffer::Decompress(compressed, slot_size, *buffer);
+	return buffer;
+}
+
+idx_t TemporaryFileHandle::GetSlotSize() const {
+	return slot_size;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,6 +330,8 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.uncompressed_size =
+	    index_manager.GetUsedBlockCount() * BufferManager::GetBufferManager(db).GetBlockAllocSize();
 	return info;
 }
 
@@ -181,7 +358,11 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
+}
+
+bool TemporaryFileHandle::IsCompressed() const {
+	return slot_size < BufferManager::GetBufferManager(db).GetBlockAllocSize();
 }
 
 //===--------------------------------------------------------------------===//
@@ -279,7 +460,14 @@ TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) :
 
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
-	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	D_ASSERT(buffer.size == buffer_manager.GetBlockSize());
+	// compress the block before taking the lock - compressed blocks are grouped into files by their slot size
+	auto compression = DBConfig::GetConfig(db).options.temp_file_compression;
+	auto compressed = CompressedTemporaryBuffer::Compress(buffer, compression);
+	auto slot_size = compressed.codec == TemporaryBufferCodec::UNCOMPRESSED
+	                     ? buffer_manager.GetBlockAllocSize()
+	                     : CompressedTemporaryBuffer::GetSlotSize(compressed.size, buffer_manager.GetBlockAllocSize());
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
@@ -288,6 +476,9 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		// first check if we can write to an open existing file
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,7 +488,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this, slot_size);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -308,7 +500,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (compressed.codec == TemporaryBufferCodec::UNCOMPRESSED) {
+		handle->WriteTemporaryFile(buffer, index);
+	} else {
+		handle->WriteTemporaryFile(compressed, index);
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -397,14 +397,37 @@ void WriteAheadLog::Flush() {
 	if (!writer) {
 		return;
 	}
+	WriteFlush();
+
+	// flushes all changes made to the WAL to disk
+	writer->Sync();
+	wal_size = writer->GetFileSize();
+}
+
+void WriteAheadLog::WriteFlush() {
+	if (!writer) {
+		return;
+	}
 
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
-
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
 	wal_size = writer->GetFileSize();
 }
 
+void WriteAheadLog::FlushBuffer() {
+	if (!writer) {
+		return;
+	}
+	writer->Flush();
+}
+
+void WriteAheadLog::Sync() {
+	if (!writer) {
+		return;
+	}
+	// the buffer is not touched here: this can run concurrently with new entries being written to the WAL
+	writer->handle->Sync();
+}
+
 } // namespace duckdb
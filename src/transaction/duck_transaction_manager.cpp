@@ -8,8 +8,10 @@
 #include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/dependency_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
@@ -223,6 +225,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	idx_t commit_sequence = 0;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -260,6 +263,10 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		if (transaction.catalog_version >= TRANSACTION_ID_START) {
 			transaction.catalog_version = ++last_committed_version;
 		}
+		if (held_wal_lock) {
+			// the commit is written to the WAL, but not yet synced to disk
+			commit_sequence = ++written_commits;
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -271,7 +278,23 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// commit successful: remove the transaction id from the list of active transactions
 	// potentially resulting in garbage collection
 	bool store_transaction = undo_properties.has_updates || undo_properties.has_catalog_changes || error.HasError();
+	unique_ptr<StorageLockKey> wal_sync_lock;
+	if (commit_sequence > 0) {
+		// removing the transaction releases its write lock - keep a shared checkpoint lock until the WAL is synced
+		// so that no checkpoint can truncate the WAL in the meantime
+		wal_sync_lock = SharedCheckpointLock();
+	}
 	RemoveTransaction(transaction, store_transaction);
+	if (commit_sequence > 0) {
+		// the changes of the transaction are visible, but the commit is only acknowledged once the WAL is synced
+		// we release the locks first, so that concurrent commits can write to the WAL and share the sync with us
+		// commits are synced in the order in which they are written to the WAL: any transaction that observed our
+		// changes can only be acknowledged after our commit has become durable as well
+		tlock.unlock();
+		held_wal_lock.reset();
+		error = SyncWAL(commit_sequence);
+		return error;
+	}
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
@@ -288,6 +311,63 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	return error;
 }
 
+ErrorData DuckTransactionManager::SyncWAL(idx_t commit_sequence) noexcept {
+	unique_lock<mutex> guard(group_commit_lock);
+	if (wal_sync_active) {
+		// let the active sync know that another commit has joined, so it can stop waiting for more commits
+		group_leader_cv.notify_one();
+	}
+	group_commit_cv.wait(guard, [&]() {
+		return synced_commits >= commit_sequence || wal_sync_error.HasError() || !wal_sync_active;
+	});
+	if (synced_commits >= commit_sequence) {
+		// another commit synced the WAL on our behalf
+		return ErrorData();
+	}
+	if (wal_sync_error.HasError()) {
+		return wal_sync_error;
+	}
+
+	// we sync the WAL on behalf of all commits that are written to it
+	wal_sync_active = true;
+	auto &config = DBConfig::Get(db);
+	auto delay = config.options.wal_group_commit_delay;
+	if (delay > 0) {
+		// wait for other commits to join this sync
+		auto group_size = config.options.wal_group_commit_size;
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(delay);
+		group_leader_cv.wait_until(guard, deadline, [&]() { return written_commits - synced_commits >= group_size; });
+	}
+	guard.unlock();
+
+	ErrorData error;
+	idx_t sync_target = 0;
+	try {
+		auto wal = db.GetStorageManager().GetWAL();
+		{
+			// write out the buffered entries of all commits up to now
+			lock_guard<mutex> wal_guard(wal_lock);
+			sync_target = written_commits;
+			wal->FlushBuffer();
+		}
+		wal->Sync();
+	} catch (std::exception &ex) {
+		// the commits are already visible to other transactions and cannot be reverted
+		ErrorData sync_error(ex);
+		error = ErrorData(ExceptionType::FATAL, "Failed to sync the write-ahead log: " + sync_error.RawMessage());
+	}
+
+	guard.lock();
+	wal_sync_active = false;
+	if (error.HasError()) {
+		wal_sync_error = error;
+	} else {
+		synced_commits = sync_target;
+	}
+	group_commit_cv.notify_all();
+	return error;
+}
+
 void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	// obtain the transaction lock during this function
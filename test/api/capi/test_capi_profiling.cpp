@@ -116,6 +116,37 @@ TEST_CASE("Test Profiling with All Metrics", "[capi]") {
 	tester.Cleanup();
 }
 
+TEST_CASE("Test Profiling with Operator Metrics", "[capi]") {
+	CAPITester tester;
+	duckdb::unique_ptr<CAPIResult> result;
+
+	// open the database in in-memory mode
+	REQUIRE(tester.OpenDatabase(nullptr));
+
+	REQUIRE_NO_FAIL(tester.Query("PRAGMA enable_profiling = 'no_output'"));
+
+	// test the metrics that are collected by the storage, the buffer manager and the scheduler
+	std::vector<string> settings = {"BYTES_READ",         "BYTES_WRITTEN",    "ROWS_FILTERED",
+	                                "ROW_GROUPS_SKIPPED", "SEGMENTS_SKIPPED", "HASH_TABLE_SIZE",
+	                                "HASH_TABLE_RESIZES", "SPILL_BYTES",      "BUFFER_PINS",
+	                                "BUFFER_EVICTIONS",   "IO_WAIT_TIME",     "SCHEDULER_WAIT_TIME"};
+	REQUIRE_NO_FAIL(tester.Query("PRAGMA custom_profiling_settings=" + BuildProfilingSettingsString(settings)));
+
+	REQUIRE_NO_FAIL(tester.Query("CREATE TABLE tbl AS SELECT range i FROM range(100000)"));
+	REQUIRE_NO_FAIL(tester.Query("SELECT i % 10, COUNT(*) FROM tbl WHERE i > 50000 GROUP BY ALL"));
+
+	auto profiling_info = duckdb_get_profiling_info(tester.connection);
+	REQUIRE(profiling_info != nullptr);
+
+	// Retrieve metric that is not enabled
+	REQUIRE(duckdb_profiling_info_get_value(profiling_info, "OPERATOR_TIMING") == nullptr);
+
+	TraverseTree(profiling_info, settings);
+
+	// Cleanup
+	tester.Cleanup();
+}
+
 TEST_CASE("Test Profiling without Enabling Profiling", "[capi]") {
 	CAPITester tester;
 	duckdb::unique_ptr<CAPIResult> result;
@@ -96,7 +96,9 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"scheduler_mode", {{"global_queue", "work_stealing", "numa_work_stealing"}}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {{"none", "lz4", "zstd", "adaptive"}}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"http_logging_output", {"my_cool_outputfile"}},